@@ -8,8 +8,11 @@
 #include "binary_array_accessor.h"
 
 #include <arrow/array.h>
+#include <arrow/util/checked_cast.h>
+#include <arrow/util/endian.h>
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 namespace driver {
 namespace flight_sql {
@@ -19,22 +22,20 @@ using namespace odbcabstraction;
 
 namespace {
 
-inline RowStatus MoveSingleCellToBinaryBuffer(ColumnBinding *binding,
-                                         BinaryArray *array, int64_t arrow_row, int64_t i,
-                                         int64_t &value_offset, bool update_value_offset, odbcabstraction::Diagnostics &diagnostics) {
+inline RowStatus MoveSingleCellToBinaryBuffer(ColumnBinding *binding, const uint8_t *value,
+                                              size_t size_in_bytes, int64_t i,
+                                              int64_t &value_offset, bool update_value_offset,
+                                              odbcabstraction::Diagnostics &diagnostics) {
   RowStatus result = odbcabstraction::RowStatus_SUCCESS;
 
-  const char *value = array->Value(arrow_row).data();
-  size_t size_in_bytes = array->value_length(arrow_row);
-
   size_t remaining_length = static_cast<size_t>(size_in_bytes - value_offset);
   size_t value_length =
       std::min(remaining_length,
                binding->buffer_length);
 
-  auto *byte_buffer = static_cast<unsigned char *>(binding->buffer) +
-                      i * binding->buffer_length;
-  memcpy(byte_buffer, ((char *)value) + value_offset, value_length);
+  auto *byte_buffer = static_cast<unsigned char *>(
+      binding->GetCellBuffer(i, binding->buffer_length));
+  memcpy(byte_buffer, value + value_offset, value_length);
 
   if (remaining_length > binding->buffer_length) {
     result = odbcabstraction::RowStatus_SUCCESS_WITH_INFO;
@@ -47,12 +48,219 @@ inline RowStatus MoveSingleCellToBinaryBuffer(ColumnBinding *binding,
   }
 
   if (binding->strlen_buffer) {
-    binding->strlen_buffer[i] = static_cast<ssize_t>(remaining_length);
+    *binding->GetCellIndicator(i) = static_cast<ssize_t>(remaining_length);
+  }
+
+  return result;
+}
+
+constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+
+constexpr uint64_t NIBBLE_MASK = 0x0F0F0F0F0F0F0F0FULL;
+constexpr uint64_t ASCII_ZEROS = 0x3030303030303030ULL;
+constexpr uint64_t LETTER_CARRY = 0x0606060606060606ULL;
+constexpr uint64_t CARRY_BITS = 0x1010101010101010ULL;
+// Distance from '9' + 1 to 'A'.
+constexpr uint64_t LETTER_OFFSET = 'A' - '9' - 1;
+
+/// Writes the eight hex characters of four bytes with 64-bit lane
+/// arithmetic: the bytes are spread one per 16-bit lane, split into one
+/// nibble per byte lane, and every lane above 9 picks up the letter offset
+/// through the carry that adding 6 pushes into its bit 4.
+inline void EncodeHex4(const uint8_t *src, char *dst) {
+  uint32_t bytes;
+  std::memcpy(&bytes, src, sizeof(bytes));
+  uint64_t spread = arrow::bit_util::FromLittleEndian(bytes);
+  spread = (spread | (spread << 16)) & 0x0000FFFF0000FFFFULL;
+  spread = (spread | (spread << 8)) & 0x00FF00FF00FF00FFULL;
+
+  const uint64_t nibbles = ((spread >> 4) & NIBBLE_MASK) | ((spread & NIBBLE_MASK) << 8);
+  const uint64_t letters = ((nibbles + LETTER_CARRY) & CARRY_BITS) >> 4;
+  const uint64_t digits =
+      arrow::bit_util::ToLittleEndian(nibbles + ASCII_ZEROS + letters * LETTER_OFFSET);
+  std::memcpy(dst, &digits, sizeof(digits));
+}
+
+/// Writes \p count characters of the hex text of \p value, starting with
+/// character \p first_char, which may fall in the middle of a byte.
+template <typename CHAR_TYPE>
+void EncodeHex(const uint8_t *value, size_t first_char, size_t count, CHAR_TYPE *out) {
+  if (count == 0) {
+    return;
+  }
+  size_t pos = first_char;
+  const size_t end = first_char + count;
+  if (pos & 1) {
+    *out++ = static_cast<CHAR_TYPE>(HEX_DIGITS[value[pos / 2] & 0xF]);
+    ++pos;
+  }
+
+  char block[8];
+  for (; end - pos >= sizeof(block); pos += sizeof(block)) {
+    if constexpr (sizeof(CHAR_TYPE) == sizeof(char)) {
+      EncodeHex4(value + pos / 2, reinterpret_cast<char *>(out));
+      out += sizeof(block);
+    } else {
+      EncodeHex4(value + pos / 2, block);
+      for (char c : block) {
+        *out++ = static_cast<CHAR_TYPE>(c);
+      }
+    }
+  }
+
+  for (; end - pos >= 2; pos += 2) {
+    const uint8_t byte = value[pos / 2];
+    *out++ = static_cast<CHAR_TYPE>(HEX_DIGITS[byte >> 4]);
+    *out++ = static_cast<CHAR_TYPE>(HEX_DIGITS[byte & 0xF]);
+  }
+  if (pos < end) {
+    *out = static_cast<CHAR_TYPE>(HEX_DIGITS[value[pos / 2] >> 4]);
+  }
+}
+
+constexpr size_t UUID_BYTES = 16;
+constexpr size_t UUID_TEXT_LENGTH = 36;
+
+/// Writes the canonical 8-4-4-4-12 form of a UUID.
+void FormatUuid(const uint8_t *value, char *out) {
+  EncodeHex(value, 0, 8, out);
+  out[8] = '-';
+  EncodeHex(value, 8, 4, out + 9);
+  out[13] = '-';
+  EncodeHex(value, 12, 4, out + 14);
+  out[18] = '-';
+  EncodeHex(value, 16, 4, out + 19);
+  out[23] = '-';
+  EncodeHex(value, 20, 12, out + 24);
+}
+
+/// UUIDs are stored big-endian, while SQLGUID holds its first three fields
+/// as native integers.
+inline void FillGuid(const uint8_t *value, SQLGUID &guid) {
+  uint32_t data1;
+  uint16_t data2, data3;
+  std::memcpy(&data1, value, sizeof(data1));
+  std::memcpy(&data2, value + 4, sizeof(data2));
+  std::memcpy(&data3, value + 6, sizeof(data3));
+  guid.Data1 = arrow::bit_util::FromBigEndian(data1);
+  guid.Data2 = arrow::bit_util::FromBigEndian(data2);
+  guid.Data3 = arrow::bit_util::FromBigEndian(data3);
+  std::memcpy(guid.Data4, value + 8, sizeof(guid.Data4));
+}
+
+inline RowStatus MoveSingleCellToGuid(ColumnBinding *binding, const uint8_t *value,
+                                      int64_t i, int64_t &value_offset,
+                                      bool update_value_offset) {
+  FillGuid(value, *static_cast<SQLGUID *>(binding->GetCellBuffer(i, sizeof(SQLGUID))));
+  if (binding->strlen_buffer) {
+    *binding->GetCellIndicator(i) = static_cast<ssize_t>(sizeof(SQLGUID));
+  }
+  if (update_value_offset) {
+    value_offset = -1;
+  }
+  return odbcabstraction::RowStatus_SUCCESS;
+}
+
+/// Writes a value rendered as \p text_chars characters into a CHAR or WCHAR
+/// buffer. \p encode(first_char, count, out) renders only the requested
+/// characters, and value_offset counts bytes of the text already returned.
+template <typename CHAR_TYPE, typename ENCODER>
+inline RowStatus MoveSingleCellToTextBuffer(ColumnBinding *binding, size_t text_chars,
+                                            int64_t i, int64_t &value_offset,
+                                            bool update_value_offset,
+                                            odbcabstraction::Diagnostics &diagnostics,
+                                            const ENCODER &encode) {
+  RowStatus result = odbcabstraction::RowStatus_SUCCESS;
+
+  const size_t size_in_bytes = text_chars * sizeof(CHAR_TYPE);
+  const size_t remaining_length = static_cast<size_t>(size_in_bytes - value_offset);
+  const size_t first_char = static_cast<size_t>(value_offset) / sizeof(CHAR_TYPE);
+
+  auto *char_buffer =
+      static_cast<CHAR_TYPE *>(binding->GetCellBuffer(i, binding->buffer_length));
+
+  if (binding->buffer_length >= remaining_length + sizeof(CHAR_TYPE)) {
+    const size_t chars = remaining_length / sizeof(CHAR_TYPE);
+    encode(first_char, chars, char_buffer);
+    char_buffer[chars] = '\0';
+    if (update_value_offset) {
+      value_offset = -1;
+    }
+  } else {
+    result = odbcabstraction::RowStatus_SUCCESS_WITH_INFO;
+    diagnostics.AddTruncationWarning();
+    size_t chars_written = binding->buffer_length / sizeof(CHAR_TYPE);
+    // If we failed to even write one char, the buffer is too small to hold a
+    // NUL-terminator.
+    if (chars_written > 0) {
+      encode(first_char, chars_written - 1, char_buffer);
+      char_buffer[chars_written - 1] = '\0';
+      if (update_value_offset) {
+        value_offset += static_cast<int64_t>((chars_written - 1) * sizeof(CHAR_TYPE));
+      }
+    }
+  }
+
+  if (binding->strlen_buffer) {
+    *binding->GetCellIndicator(i) = static_cast<ssize_t>(remaining_length);
   }
 
   return result;
 }
 
+template <typename CHAR_TYPE>
+inline RowStatus MoveSingleCellToHexBuffer(ColumnBinding *binding, const uint8_t *value,
+                                           size_t size_in_bytes, int64_t i,
+                                           int64_t &value_offset, bool update_value_offset,
+                                           odbcabstraction::Diagnostics &diagnostics) {
+  return MoveSingleCellToTextBuffer<CHAR_TYPE>(
+      binding, 2 * size_in_bytes, i, value_offset, update_value_offset, diagnostics,
+      [value](size_t first_char, size_t count, CHAR_TYPE *out) {
+        EncodeHex(value, first_char, count, out);
+      });
+}
+
+template <typename CHAR_TYPE>
+inline RowStatus MoveSingleCellToUuidText(ColumnBinding *binding, const uint8_t *value,
+                                          int64_t i, int64_t &value_offset,
+                                          bool update_value_offset,
+                                          odbcabstraction::Diagnostics &diagnostics) {
+  return MoveSingleCellToTextBuffer<CHAR_TYPE>(
+      binding, UUID_TEXT_LENGTH, i, value_offset, update_value_offset, diagnostics,
+      [value](size_t first_char, size_t count, CHAR_TYPE *out) {
+        char text[UUID_TEXT_LENGTH];
+        FormatUuid(value, text);
+        std::copy(text + first_char, text + first_char + count, out);
+      });
+}
+
+template <template <CDataType, typename> class ACCESSOR>
+Accessor *CreateBinaryTargetAccessor(arrow::Array *array, CDataType target_type) {
+  switch (target_type) {
+    case CDataType_BINARY:
+      return new ACCESSOR<CDataType_BINARY, char>(array);
+    case CDataType_GUID:
+      return new ACCESSOR<CDataType_GUID, char>(array);
+    case CDataType_CHAR:
+      return new ACCESSOR<CDataType_CHAR, char>(array);
+    case CDataType_WCHAR:
+      switch (GetSqlWCharSize()) {
+        case sizeof(char16_t):
+          return new ACCESSOR<CDataType_WCHAR, char16_t>(array);
+        case sizeof(char32_t):
+          return new ACCESSOR<CDataType_WCHAR, char32_t>(array);
+        default:
+          assert(false);
+          throw DriverException("Encoding is unsupported, SQLWCHAR size: " +
+                                std::to_string(GetSqlWCharSize()));
+      }
+    default:
+      throw DriverException("Unsupported conversion from " + array->type()->ToString() +
+                                " to C type " + std::to_string(target_type),
+                            "07006");
+  }
+}
+
 } // namespace
 
 template <CDataType TARGET_TYPE>
@@ -65,8 +273,10 @@ template <>
 RowStatus BinaryArrayFlightSqlAccessor<CDataType_BINARY>::MoveSingleCell_impl(
     ColumnBinding *binding, int64_t arrow_row, int64_t i, int64_t &value_offset,
     bool update_value_offset, odbcabstraction::Diagnostics &diagnostics) {
-  return MoveSingleCellToBinaryBuffer(binding, this->GetArray(), arrow_row, i, value_offset,
-                                      update_value_offset, diagnostics);
+  const std::string_view value = this->GetArray()->GetView(arrow_row);
+  return MoveSingleCellToBinaryBuffer(binding, reinterpret_cast<const uint8_t *>(value.data()),
+                                      value.size(), i, value_offset, update_value_offset,
+                                      diagnostics);
 }
 
 template <CDataType TARGET_TYPE>
@@ -76,5 +286,129 @@ size_t BinaryArrayFlightSqlAccessor<TARGET_TYPE>::GetCellLength_impl(ColumnBindi
 
 template class BinaryArrayFlightSqlAccessor<odbcabstraction::CDataType_BINARY>;
 
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+BinaryToHexFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::BinaryToHexFlightSqlAccessor(
+    Array *array)
+    : FlightSqlAccessor<BinaryArray, TARGET_TYPE,
+                        BinaryToHexFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>>(array) {}
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+RowStatus BinaryToHexFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::MoveSingleCell_impl(
+    ColumnBinding *binding, int64_t arrow_row, int64_t i, int64_t &value_offset,
+    bool update_value_offset, odbcabstraction::Diagnostics &diagnostics) {
+  const std::string_view value = this->GetArray()->GetView(arrow_row);
+  return MoveSingleCellToHexBuffer<CHAR_TYPE>(
+      binding, reinterpret_cast<const uint8_t *>(value.data()), value.size(), i, value_offset,
+      update_value_offset, diagnostics);
+}
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+size_t BinaryToHexFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::GetCellLength_impl(
+    ColumnBinding *binding) const {
+  return binding->buffer_length;
+}
+
+template class BinaryToHexFlightSqlAccessor<odbcabstraction::CDataType_CHAR, char>;
+template class BinaryToHexFlightSqlAccessor<odbcabstraction::CDataType_WCHAR, char16_t>;
+template class BinaryToHexFlightSqlAccessor<odbcabstraction::CDataType_WCHAR, char32_t>;
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+FixedSizeBinaryArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::
+    FixedSizeBinaryArrayFlightSqlAccessor(Array *array)
+    : FlightSqlAccessor<FixedSizeBinaryArray, TARGET_TYPE,
+                        FixedSizeBinaryArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>>(array) {
+  if constexpr (TARGET_TYPE == CDataType_GUID) {
+    if (this->GetArray()->byte_width() != UUID_BYTES) {
+      throw DriverException("Only 16-byte binary values convert to SQL_C_GUID", "07006");
+    }
+  }
+}
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+RowStatus FixedSizeBinaryArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::MoveSingleCell_impl(
+    ColumnBinding *binding, int64_t arrow_row, int64_t i, int64_t &value_offset,
+    bool update_value_offset, odbcabstraction::Diagnostics &diagnostics) {
+  auto *array = this->GetArray();
+  const uint8_t *value = array->GetValue(arrow_row);
+  if constexpr (TARGET_TYPE == CDataType_GUID) {
+    return MoveSingleCellToGuid(binding, value, i, value_offset, update_value_offset);
+  } else if constexpr (TARGET_TYPE == CDataType_BINARY) {
+    return MoveSingleCellToBinaryBuffer(binding, value, array->byte_width(), i, value_offset,
+                                        update_value_offset, diagnostics);
+  } else {
+    return MoveSingleCellToHexBuffer<CHAR_TYPE>(binding, value, array->byte_width(), i,
+                                                value_offset, update_value_offset,
+                                                diagnostics);
+  }
+}
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+size_t FixedSizeBinaryArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::GetCellLength_impl(
+    ColumnBinding *binding) const {
+  if constexpr (TARGET_TYPE == CDataType_GUID) {
+    return sizeof(SQLGUID);
+  } else {
+    return binding->buffer_length;
+  }
+}
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+UuidArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::UuidArrayFlightSqlAccessor(Array *array)
+    : FlightSqlAccessor<ExtensionArray, TARGET_TYPE,
+                        UuidArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>>(array) {
+  OnArrayChanged_impl();
+}
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+RowStatus UuidArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::MoveSingleCell_impl(
+    ColumnBinding *binding, int64_t arrow_row, int64_t i, int64_t &value_offset,
+    bool update_value_offset, odbcabstraction::Diagnostics &diagnostics) {
+  const uint8_t *value = storage_->GetValue(arrow_row);
+  if constexpr (TARGET_TYPE == CDataType_GUID) {
+    return MoveSingleCellToGuid(binding, value, i, value_offset, update_value_offset);
+  } else if constexpr (TARGET_TYPE == CDataType_BINARY) {
+    return MoveSingleCellToBinaryBuffer(binding, value, UUID_BYTES, i, value_offset,
+                                        update_value_offset, diagnostics);
+  } else {
+    return MoveSingleCellToUuidText<CHAR_TYPE>(binding, value, i, value_offset,
+                                               update_value_offset, diagnostics);
+  }
+}
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+size_t UuidArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::GetCellLength_impl(
+    ColumnBinding *binding) const {
+  if constexpr (TARGET_TYPE == CDataType_GUID) {
+    return sizeof(SQLGUID);
+  } else {
+    return binding->buffer_length;
+  }
+}
+
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+void UuidArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::OnArrayChanged_impl() {
+  storage_ = arrow::internal::checked_cast<FixedSizeBinaryArray *>(this->GetArray()->storage().get());
+}
+
+template class FixedSizeBinaryArrayFlightSqlAccessor<odbcabstraction::CDataType_BINARY, char>;
+template class FixedSizeBinaryArrayFlightSqlAccessor<odbcabstraction::CDataType_GUID, char>;
+template class FixedSizeBinaryArrayFlightSqlAccessor<odbcabstraction::CDataType_CHAR, char>;
+template class FixedSizeBinaryArrayFlightSqlAccessor<odbcabstraction::CDataType_WCHAR, char16_t>;
+template class FixedSizeBinaryArrayFlightSqlAccessor<odbcabstraction::CDataType_WCHAR, char32_t>;
+
+template class UuidArrayFlightSqlAccessor<odbcabstraction::CDataType_BINARY, char>;
+template class UuidArrayFlightSqlAccessor<odbcabstraction::CDataType_GUID, char>;
+template class UuidArrayFlightSqlAccessor<odbcabstraction::CDataType_CHAR, char>;
+template class UuidArrayFlightSqlAccessor<odbcabstraction::CDataType_WCHAR, char16_t>;
+template class UuidArrayFlightSqlAccessor<odbcabstraction::CDataType_WCHAR, char32_t>;
+
+Accessor *CreateFixedSizeBinaryAccessor(arrow::Array *array, CDataType target_type) {
+  return CreateBinaryTargetAccessor<FixedSizeBinaryArrayFlightSqlAccessor>(array, target_type);
+}
+
+Accessor *CreateUuidAccessor(arrow::Array *array, CDataType target_type) {
+  return CreateBinaryTargetAccessor<UuidArrayFlightSqlAccessor>(array, target_type);
+}
+
 } // namespace flight_sql
 } // namespace driver
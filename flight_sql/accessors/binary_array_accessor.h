@@ -9,7 +9,11 @@
 
 #include "arrow/type_fwd.h"
 #include "types.h"
+#include <arrow/extension_type.h>
+#include <odbcabstraction/encoding.h>
+#include <odbcabstraction/platform.h>
 #include <odbcabstraction/types.h>
+#include <sql.h>
 
 namespace driver {
 namespace flight_sql {
@@ -31,5 +35,83 @@ public:
   size_t GetCellLength_impl(ColumnBinding *binding) const;
 };
 
+/// \brief Accessor returning binary values as uppercase hex text, two
+/// characters per byte, as ODBC requires for binary data fetched as
+/// SQL_C_CHAR or SQL_C_WCHAR. The text is encoded straight into the bound
+/// buffer, and \p value_offset counts bytes of that text, so SQLGetData can
+/// stream a large value without materializing its hex form.
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+class BinaryToHexFlightSqlAccessor
+    : public FlightSqlAccessor<BinaryArray, TARGET_TYPE,
+                               BinaryToHexFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>> {
+public:
+  explicit BinaryToHexFlightSqlAccessor(Array *array);
+
+  RowStatus MoveSingleCell_impl(ColumnBinding *binding, int64_t arrow_row, int64_t i,
+                                int64_t &value_offset, bool update_value_offset,
+                                odbcabstraction::Diagnostics &diagnostics);
+
+  size_t GetCellLength_impl(ColumnBinding *binding) const;
+};
+
+inline Accessor* CreateWCharBinaryToHexAccessor(arrow::Array *array) {
+  switch(GetSqlWCharSize()) {
+    case sizeof(char16_t):
+      return new BinaryToHexFlightSqlAccessor<CDataType_WCHAR, char16_t>(array);
+    case sizeof(char32_t):
+      return new BinaryToHexFlightSqlAccessor<CDataType_WCHAR, char32_t>(array);
+    default:
+      assert(false);
+      throw DriverException("Encoding is unsupported, SQLWCHAR size: " + std::to_string(GetSqlWCharSize()));
+  }
+}
+
+/// \brief Accessor for FIXED_SIZE_BINARY arrays. BINARY targets receive the
+/// bytes as they are and CHAR and WCHAR targets their hex text. Arrays of
+/// 16-byte values can also fill SQLGUID.
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+class FixedSizeBinaryArrayFlightSqlAccessor
+    : public FlightSqlAccessor<FixedSizeBinaryArray, TARGET_TYPE,
+                               FixedSizeBinaryArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>> {
+public:
+  explicit FixedSizeBinaryArrayFlightSqlAccessor(Array *array);
+
+  RowStatus MoveSingleCell_impl(ColumnBinding *binding, int64_t arrow_row, int64_t i,
+                                int64_t &value_offset, bool update_value_offset,
+                                odbcabstraction::Diagnostics &diagnostics);
+
+  size_t GetCellLength_impl(ColumnBinding *binding) const;
+};
+
+/// \brief Accessor for arrays of the arrow.uuid extension type. GUID targets
+/// receive an SQLGUID, BINARY targets the 16 bytes and CHAR and WCHAR targets
+/// the canonical 36-character form.
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+class UuidArrayFlightSqlAccessor
+    : public FlightSqlAccessor<ExtensionArray, TARGET_TYPE,
+                               UuidArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>> {
+public:
+  explicit UuidArrayFlightSqlAccessor(Array *array);
+
+  RowStatus MoveSingleCell_impl(ColumnBinding *binding, int64_t arrow_row, int64_t i,
+                                int64_t &value_offset, bool update_value_offset,
+                                odbcabstraction::Diagnostics &diagnostics);
+
+  size_t GetCellLength_impl(ColumnBinding *binding) const;
+
+  void OnArrayChanged_impl();
+
+private:
+  FixedSizeBinaryArray *storage_;
+};
+
+/// \brief Creates an accessor converting a FIXED_SIZE_BINARY array to a
+/// BINARY, GUID, CHAR or WCHAR target.
+Accessor* CreateFixedSizeBinaryAccessor(arrow::Array *array, CDataType target_type);
+
+/// \brief Creates an accessor converting an arrow.uuid array to a BINARY,
+/// GUID, CHAR or WCHAR target.
+Accessor* CreateUuidAccessor(arrow::Array *array, CDataType target_type);
+
 } // namespace flight_sql
 } // namespace driver
@@ -8,7 +8,11 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/builder.h"
 #include "binary_array_accessor.h"
+#include "utils.h"
+#include <arrow/builder.h>
+#include <arrow/extension/uuid.h>
 #include "gtest/gtest.h"
+#include <iomanip>
 
 namespace driver {
 namespace flight_sql {
@@ -89,5 +93,180 @@ TEST(BinaryArrayAccessor, Test_CDataType_BINARY_Truncation) {
   ASSERT_EQ(values[0], ss.str());
 }
 
+TEST(BinaryArrayAccessor, Test_CDataType_CHAR_Hex) {
+  std::vector<std::string> values = {std::string("\x00\x01\xAB\xFF\x10\x9A\x5C\xE7\x42", 9),
+                                     "", "z"};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<BinaryType, std::string>(values, &array);
+
+  BinaryToHexFlightSqlAccessor<CDataType_CHAR, char> accessor(array.get());
+
+  size_t max_strlen = 64;
+  std::vector<char> buffer(values.size() * max_strlen);
+  std::vector<ssize_t> strlen_buffer(values.size());
+
+  ColumnBinding binding(CDataType_CHAR, 0, 0, buffer.data(), max_strlen,
+                        strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(values.size(),
+            accessor.GetColumnarData(&binding, 0, values.size(), value_offset, false, diagnostics, nullptr));
+
+  ASSERT_EQ(18, strlen_buffer[0]);
+  ASSERT_STREQ("0001ABFF109A5CE742", buffer.data());
+  ASSERT_EQ(0, strlen_buffer[1]);
+  ASSERT_STREQ("", buffer.data() + max_strlen);
+  ASSERT_STREQ("7A", buffer.data() + 2 * max_strlen);
+}
+
+TEST(BinaryArrayAccessor, Test_CDataType_CHAR_HexTruncation) {
+  std::string value;
+  for (int i = 0; i < 37; ++i) {
+    value.push_back(static_cast<char>(i * 7));
+  }
+  std::stringstream expected;
+  for (unsigned char c : value) {
+    expected << std::uppercase << std::hex << std::setw(2) << std::setfill('0')
+             << static_cast<int>(c);
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<BinaryType, std::string>({value}, &array);
+
+  BinaryToHexFlightSqlAccessor<CDataType_CHAR, char> accessor(array.get());
+
+  // An even buffer leaves room for an odd number of hex characters, so
+  // chunks start in the middle of a byte.
+  size_t max_strlen = 8;
+  std::vector<char> buffer(max_strlen);
+  std::vector<ssize_t> strlen_buffer(1);
+
+  ColumnBinding binding(CDataType_CHAR, 0, 0, buffer.data(), max_strlen,
+                        strlen_buffer.data());
+
+  std::string hex;
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  do {
+    int64_t original_value_offset = value_offset;
+    ASSERT_EQ(1, accessor.GetColumnarData(&binding, 0, 1, value_offset, true, diagnostics, nullptr));
+    ASSERT_EQ(expected.str().length() - original_value_offset, strlen_buffer[0]);
+    hex += buffer.data();
+  } while (value_offset != -1);
+
+  ASSERT_EQ(expected.str(), hex);
+}
+
+TEST(BinaryArrayAccessor, Test_CDataType_WCHAR_Hex) {
+  std::vector<std::string> values = {std::string("\x0F\xA0\x00\xC3\x7E", 5)};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<BinaryType, std::string>(values, &array);
+
+  std::unique_ptr<Accessor> accessor(CreateWCharBinaryToHexAccessor(array.get()));
+
+  size_t max_strlen = 64;
+  std::vector<uint8_t> buffer(max_strlen);
+  std::vector<ssize_t> strlen_buffer(1);
+
+  ColumnBinding binding(CDataType_WCHAR, 0, 0, buffer.data(), max_strlen,
+                        strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(1, accessor->GetColumnarData(&binding, 0, 1, value_offset, false, diagnostics, nullptr));
+
+  ASSERT_EQ(10 * GetSqlWCharSize(), strlen_buffer[0]);
+  std::vector<uint8_t> expected;
+  Utf8ToWcs("0FA000C37E", &expected);
+  ASSERT_EQ(expected, std::vector<uint8_t>(buffer.data(), buffer.data() + strlen_buffer[0]));
+}
+
+namespace {
+
+std::shared_ptr<Array> MakeFixedSizeBinaryArray(int32_t byte_width,
+                                                const std::vector<std::string> &values) {
+  FixedSizeBinaryBuilder builder(fixed_size_binary(byte_width));
+  for (const auto &value : values) {
+    EXPECT_TRUE(builder.Append(value).ok());
+  }
+  EXPECT_TRUE(builder.AppendNull().ok());
+  std::shared_ptr<Array> array;
+  EXPECT_TRUE(builder.Finish(&array).ok());
+  return array;
+}
+
+const std::string UUID_BYTES("\x12\x34\x56\x78\x9A\xBC\xDE\xF0\x01\x23\x45\x67\x89\xAB\xCD\xEF",
+                             16);
+
+} // namespace
+
+TEST(BinaryArrayAccessor, Test_FixedSizeBinary_BINARY_and_CHAR) {
+  auto array = MakeFixedSizeBinaryArray(3, {std::string("\x01\xFE\x00", 3), "abc"});
+
+  std::unique_ptr<Accessor> binary_accessor(
+      CreateFixedSizeBinaryAccessor(array.get(), CDataType_BINARY));
+  std::vector<char> bytes(3 * 3);
+  std::vector<ssize_t> strlen_buffer(3);
+  ColumnBinding binary_binding(CDataType_BINARY, 0, 0, bytes.data(), 3, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(3, binary_accessor->GetColumnarData(&binary_binding, 0, 3, value_offset, false,
+                                                diagnostics, nullptr));
+  ASSERT_EQ(3, strlen_buffer[0]);
+  ASSERT_EQ(std::string("\x01\xFE\x00abc", 6), std::string(bytes.data(), 6));
+  ASSERT_EQ(odbcabstraction::NULL_DATA, strlen_buffer[2]);
+
+  std::unique_ptr<Accessor> char_accessor(
+      CreateFixedSizeBinaryAccessor(array.get(), CDataType_CHAR));
+  std::vector<char> text(2 * 16);
+  ColumnBinding char_binding(CDataType_CHAR, 0, 0, text.data(), 16, strlen_buffer.data());
+  ASSERT_EQ(2, char_accessor->GetColumnarData(&char_binding, 0, 2, value_offset, false,
+                                              diagnostics, nullptr));
+  ASSERT_EQ(6, strlen_buffer[0]);
+  ASSERT_STREQ("01FE00", text.data());
+  ASSERT_STREQ("616263", text.data() + 16);
+
+  // Only 16-byte values can be GUIDs.
+  ASSERT_THROW(CreateFixedSizeBinaryAccessor(array.get(), CDataType_GUID), DriverException);
+}
+
+TEST(BinaryArrayAccessor, Test_Uuid_GUID_and_CHAR) {
+  auto storage = MakeFixedSizeBinaryArray(16, {UUID_BYTES});
+  auto array = ExtensionType::WrapArray(arrow::extension::uuid(), storage);
+  ASSERT_TRUE(IsUuidType(*array->type()));
+
+  std::unique_ptr<Accessor> guid_accessor(CreateUuidAccessor(array.get(), CDataType_GUID));
+  std::vector<SQLGUID> guids(2);
+  std::vector<ssize_t> strlen_buffer(2);
+  ColumnBinding guid_binding(CDataType_GUID, 0, 0, guids.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(2, guid_accessor->GetColumnarData(&guid_binding, 0, 2, value_offset, false,
+                                              diagnostics, nullptr));
+  ASSERT_EQ(sizeof(SQLGUID), strlen_buffer[0]);
+  ASSERT_EQ(0x12345678u, guids[0].Data1);
+  ASSERT_EQ(0x9ABC, guids[0].Data2);
+  ASSERT_EQ(0xDEF0, guids[0].Data3);
+  ASSERT_EQ(0x01, guids[0].Data4[0]);
+  ASSERT_EQ(0xEF, guids[0].Data4[7]);
+  ASSERT_EQ(odbcabstraction::NULL_DATA, strlen_buffer[1]);
+
+  std::unique_ptr<Accessor> char_accessor(CreateUuidAccessor(array.get(), CDataType_CHAR));
+  std::vector<char> text(16);
+  ColumnBinding char_binding(CDataType_CHAR, 0, 0, text.data(), text.size(),
+                             strlen_buffer.data());
+
+  // Read the text in chunks as SQLGetData would.
+  std::string uuid;
+  do {
+    ASSERT_EQ(1, char_accessor->GetColumnarData(&char_binding, 0, 1, value_offset, true,
+                                                diagnostics, nullptr));
+    uuid += text.data();
+  } while (value_offset != -1);
+  ASSERT_EQ("12345678-9ABC-DEF0-0123-456789ABCDEF", uuid);
+}
+
 } // namespace flight_sql
 } // namespace driver
@@ -7,18 +7,128 @@
 
 #include "boolean_array_accessor.h"
 
+#include <arrow/array.h>
+#include <arrow/util/bit_util.h>
+#include <arrow/util/bitmap_ops.h>
+#include <algorithm>
+#include <cstring>
+
 namespace driver {
 namespace flight_sql {
 
 using namespace arrow;
 using namespace odbcabstraction;
 
+namespace {
+
+/// Lookup table mapping a bitmap byte to the eight SQL_C_BIT bytes it holds,
+/// least significant bit first as in Arrow's bitmap layout.
+struct BitUnpackTable {
+  uint8_t entries[256][8];
+
+  constexpr BitUnpackTable() : entries() {
+    for (int byte = 0; byte < 256; ++byte) {
+      for (int bit = 0; bit < 8; ++bit) {
+        entries[byte][bit] = static_cast<uint8_t>((byte >> bit) & 1);
+      }
+    }
+  }
+};
+
+constexpr BitUnpackTable BIT_UNPACK_TABLE;
+
+/// Writes one byte (0 or 1) per bit in [bit_offset, bit_offset + length) of
+/// the bitmap. Whole bytes are expanded with a single table lookup.
+inline void UnpackBitmapToBytes(const uint8_t *bitmap, int64_t bit_offset,
+                                int64_t length, uint8_t *out) {
+  int64_t i = 0;
+  for (; i < length && ((bit_offset + i) & 7) != 0; ++i) {
+    out[i] = bit_util::GetBit(bitmap, bit_offset + i) ? 1 : 0;
+  }
+
+  const uint8_t *bytes = bitmap + ((bit_offset + i) >> 3);
+  for (; i + 8 <= length; i += 8, ++bytes) {
+    memcpy(out + i, BIT_UNPACK_TABLE.entries[*bytes], 8);
+  }
+
+  for (; i < length; ++i) {
+    out[i] = bit_util::GetBit(bitmap, bit_offset + i) ? 1 : 0;
+  }
+}
+
+/// Writes cell_length for valid rows and NULL_DATA for null rows. Bytes with
+/// all eight rows valid are filled without testing individual bits.
+inline void FillIndicatorsFromValidity(const uint8_t *validity, int64_t bit_offset,
+                                       int64_t length, ssize_t cell_length,
+                                       ssize_t *out) {
+  int64_t i = 0;
+  for (; i < length && ((bit_offset + i) & 7) != 0; ++i) {
+    out[i] = bit_util::GetBit(validity, bit_offset + i) ? cell_length : NULL_DATA;
+  }
+
+  const uint8_t *bytes = validity + ((bit_offset + i) >> 3);
+  for (; i + 8 <= length; i += 8, ++bytes) {
+    if (*bytes == 0xFF) {
+      std::fill(out + i, out + i + 8, cell_length);
+    } else {
+      for (int bit = 0; bit < 8; ++bit) {
+        out[i + bit] = ((*bytes >> bit) & 1) ? cell_length : NULL_DATA;
+      }
+    }
+  }
+
+  for (; i < length; ++i) {
+    out[i] = bit_util::GetBit(validity, bit_offset + i) ? cell_length : NULL_DATA;
+  }
+}
+
+} // namespace
+
 template <CDataType TARGET_TYPE>
 BooleanArrayFlightSqlAccessor<TARGET_TYPE>::BooleanArrayFlightSqlAccessor(
     Array *array)
     : FlightSqlAccessor<BooleanArray, TARGET_TYPE,
                         BooleanArrayFlightSqlAccessor<TARGET_TYPE>>(array) {}
 
+template <CDataType TARGET_TYPE>
+size_t BooleanArrayFlightSqlAccessor<TARGET_TYPE>::GetColumnarData_impl(
+    ColumnBinding *binding, int64_t starting_row, int64_t cells,
+    int64_t &value_offset, bool update_value_offset,
+    odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array) {
+  if (binding->row_stride) {
+    // Row-wise binding scatters the cells, so there is no contiguous run of
+    // bytes to unpack into.
+    return FlightSqlAccessor<BooleanArray, TARGET_TYPE, BooleanArrayFlightSqlAccessor<TARGET_TYPE>>::
+        GetColumnarData_impl(binding, starting_row, cells, value_offset, update_value_offset,
+                             diagnostics, row_status_array);
+  }
+
+  BooleanArray *array = this->GetArray();
+  const int64_t bit_offset = array->offset() + starting_row;
+
+  // Null rows get a value byte too; ODBC leaves it undefined when the
+  // indicator is SQL_NULL_DATA.
+  UnpackBitmapToBytes(array->values()->data(), bit_offset, cells,
+                      static_cast<uint8_t *>(binding->buffer));
+
+  const uint8_t *validity =
+      array->null_count() != 0 ? array->null_bitmap_data() : nullptr;
+  if (binding->strlen_buffer) {
+    const auto cell_length = static_cast<ssize_t>(GetCellLength_impl(binding));
+    if (validity) {
+      FillIndicatorsFromValidity(validity, bit_offset, cells, cell_length,
+                                 binding->strlen_buffer);
+    } else {
+      std::fill(binding->strlen_buffer, binding->strlen_buffer + cells, cell_length);
+    }
+  } else if (validity &&
+             arrow::internal::CountSetBits(validity, bit_offset, cells) != cells) {
+    throw odbcabstraction::NullWithoutIndicatorException();
+  }
+
+  return static_cast<size_t>(cells);
+}
+
 template <CDataType TARGET_TYPE>
 RowStatus BooleanArrayFlightSqlAccessor<TARGET_TYPE>::MoveSingleCell_impl(
     ColumnBinding *binding, int64_t arrow_row, int64_t i, int64_t &value_offset,
@@ -26,11 +136,11 @@ RowStatus BooleanArrayFlightSqlAccessor<TARGET_TYPE>::MoveSingleCell_impl(
   typedef unsigned char c_type;
   bool value = this->GetArray()->Value(arrow_row);
 
-  auto *buffer = static_cast<c_type *>(binding->buffer);
-  buffer[i] = value ? 1 : 0;
+  auto *buffer = static_cast<c_type *>(binding->GetCellBuffer(i, sizeof(c_type)));
+  *buffer = value ? 1 : 0;
 
   if (binding->strlen_buffer) {
-    binding->strlen_buffer[i] = static_cast<ssize_t>(GetCellLength_impl(binding));
+    *binding->GetCellIndicator(i) = static_cast<ssize_t>(GetCellLength_impl(binding));
   }
 
   return odbcabstraction::RowStatus_SUCCESS;
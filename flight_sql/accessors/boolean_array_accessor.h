@@ -25,6 +25,12 @@ class BooleanArrayFlightSqlAccessor
 public:
   explicit BooleanArrayFlightSqlAccessor(Array *array);
 
+  /// \brief Unpacks the values bitmap into one byte per cell, eight cells per
+  /// table lookup, instead of going through MoveSingleCell_impl per row.
+  size_t GetColumnarData_impl(ColumnBinding *binding, int64_t starting_row, int64_t cells,
+                              int64_t &value_offset, bool update_value_offset,
+                              odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array);
+
   RowStatus MoveSingleCell_impl(ColumnBinding *binding, int64_t arrow_row,
                                 int64_t i, int64_t &value_offset,
                                 bool update_value_offset,
@@ -38,5 +38,60 @@ TEST(BooleanArrayFlightSqlAccessor, Test_BooleanArray_CDataType_BIT) {
   }
 }
 
+TEST(BooleanArrayFlightSqlAccessor, Test_BooleanArray_CDataType_BIT_WithNullsAndOffset) {
+  std::vector<bool> values;
+  std::vector<bool> is_valid;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(i % 3 == 0);
+    is_valid.push_back(i % 7 != 0);
+  }
+  std::shared_ptr<Array> full_array;
+  ArrayFromVector<BooleanType, bool>(is_valid, values, &full_array);
+
+  // Slice so the first row does not start on a byte boundary of the bitmaps.
+  const int64_t slice_offset = 5;
+  std::shared_ptr<Array> array = full_array->Slice(slice_offset);
+
+  BooleanArrayFlightSqlAccessor<CDataType_BIT> accessor(array.get());
+
+  // Start in the middle of the slice to exercise unaligned leading bits.
+  const int64_t starting_row = 3;
+  const size_t cells = array->length() - starting_row;
+  std::vector<char> buffer(cells);
+  std::vector<ssize_t> strlen_buffer(cells);
+
+  ColumnBinding binding(CDataType_BIT, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(cells,
+            accessor.GetColumnarData(&binding, starting_row, cells, value_offset, false, diagnostics, nullptr));
+
+  for (size_t i = 0; i < cells; ++i) {
+    const size_t source_row = slice_offset + starting_row + i;
+    if (is_valid[source_row]) {
+      ASSERT_EQ(sizeof(unsigned char), strlen_buffer[i]);
+      ASSERT_EQ(values[source_row] ? 1 : 0, buffer[i]);
+    } else {
+      ASSERT_EQ(odbcabstraction::NULL_DATA, strlen_buffer[i]);
+    }
+  }
+}
+
+TEST(BooleanArrayFlightSqlAccessor, Test_BooleanArray_NullWithoutIndicator) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<BooleanType, bool>({true, false}, {true, true}, &array);
+
+  BooleanArrayFlightSqlAccessor<CDataType_BIT> accessor(array.get());
+
+  std::vector<char> buffer(2);
+  ColumnBinding binding(CDataType_BIT, 0, 0, buffer.data(), 0, nullptr);
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_THROW(accessor.GetColumnarData(&binding, 0, 2, value_offset, false, diagnostics, nullptr),
+               odbcabstraction::NullWithoutIndicatorException);
+}
+
 } // namespace flight_sql
 } // namespace driver
@@ -21,6 +21,13 @@ namespace flight_sql {
 using namespace arrow;
 using namespace odbcabstraction;
 
+inline void MarkRowStatus(uint16_t *row_status_array, int64_t i, RowStatus row_status) {
+  // Do not downgrade a status already set by another column of the same row.
+  if (row_status_array && row_status_array[i] != RowStatus_ERROR) {
+    row_status_array[i] = row_status;
+  }
+}
+
 template <typename ARRAY_TYPE>
 inline size_t CopyFromArrayValuesToBinding(ARRAY_TYPE* array,
                                            ColumnBinding *binding,
@@ -31,9 +38,9 @@ inline size_t CopyFromArrayValuesToBinding(ARRAY_TYPE* array,
     for (int64_t i = 0; i < cells; ++i) {
       int64_t current_row = starting_row + i;
       if (array->IsNull(current_row)) {
-        binding->strlen_buffer[i] = NULL_DATA;
+        *binding->GetCellIndicator(i) = NULL_DATA;
       } else {
-        binding->strlen_buffer[i] = element_size;
+        *binding->GetCellIndicator(i) = element_size;
       }
     }
   } else {
@@ -49,7 +56,14 @@ inline size_t CopyFromArrayValuesToBinding(ARRAY_TYPE* array,
   // Note that the array should already have been sliced down to the same number
   // of elements in the ODBC data array by the point in which this function is called.
   const auto *values = array->raw_values();
-  memcpy(binding->buffer, &values[starting_row], element_size * cells);
+  if (binding->row_stride) {
+    // Row-wise binding: one value per application row struct.
+    for (int64_t i = 0; i < cells; ++i) {
+      memcpy(binding->GetCellBuffer(i, element_size), &values[starting_row + i], element_size);
+    }
+  } else {
+    memcpy(binding->buffer, &values[starting_row], element_size * cells);
+  }
 
   return cells;
 }
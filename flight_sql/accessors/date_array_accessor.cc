@@ -49,18 +49,18 @@ template <CDataType TARGET_TYPE, typename ARROW_ARRAY>
 RowStatus DateArrayFlightSqlAccessor<TARGET_TYPE, ARROW_ARRAY>::MoveSingleCell_impl(
     ColumnBinding *binding, int64_t arrow_row, int64_t cell_counter, int64_t &value_offset,
     bool update_value_offset, odbcabstraction::Diagnostics &diagnostics) {
-  auto *buffer = static_cast<DATE_STRUCT *>(binding->buffer);
+  auto *buffer = static_cast<DATE_STRUCT *>(binding->GetCellBuffer(cell_counter, sizeof(DATE_STRUCT)));
   auto value = convertDate<ARROW_ARRAY>(this->GetArray()->Value(arrow_row));
   tm date{};
 
   GetTimeForSecondsSinceEpoch(date, value);
 
-  buffer[cell_counter].year = 1900 + (date.tm_year);
-  buffer[cell_counter].month = date.tm_mon + 1;
-  buffer[cell_counter].day = date.tm_mday;
+  buffer->year = 1900 + (date.tm_year);
+  buffer->month = date.tm_mon + 1;
+  buffer->day = date.tm_mday;
 
   if (binding->strlen_buffer) {
-    binding->strlen_buffer[cell_counter] = static_cast<ssize_t>(GetCellLength_impl(binding));
+    *binding->GetCellIndicator(cell_counter) = static_cast<ssize_t>(GetCellLength_impl(binding));
   }
 
   return odbcabstraction::RowStatus_SUCCESS;
@@ -28,7 +28,7 @@ template <>
 RowStatus DecimalArrayFlightSqlAccessor<Decimal128Array, CDataType_NUMERIC>::MoveSingleCell_impl(
     ColumnBinding *binding, int64_t arrow_row, int64_t i, int64_t &value_offset,
     bool update_value_offset, odbcabstraction::Diagnostics &diagnostics) {
-  auto result = &(static_cast<NUMERIC_STRUCT *>(binding->buffer)[i]);
+  auto result = static_cast<NUMERIC_STRUCT *>(binding->GetCellBuffer(i, sizeof(NUMERIC_STRUCT)));
   int32_t original_scale = data_type_->scale();
 
   const uint8_t* bytes = this->GetArray()->Value(arrow_row);
@@ -57,7 +57,7 @@ RowStatus DecimalArrayFlightSqlAccessor<Decimal128Array, CDataType_NUMERIC>::Mov
   result->precision = data_type_->precision();
 
   if (binding->strlen_buffer) {
-    binding->strlen_buffer[i] = static_cast<ssize_t>(GetCellLength_impl(binding));
+    *binding->GetCellIndicator(i) = static_cast<ssize_t>(GetCellLength_impl(binding));
   }
 
   return odbcabstraction::RowStatus_SUCCESS;
@@ -68,6 +68,11 @@ size_t DecimalArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>::GetCellLength_im
   return sizeof(NUMERIC_STRUCT);
 }
 
+template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
+void DecimalArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>::OnArrayChanged_impl() {
+  data_type_ = static_cast<Decimal128Type*>(this->GetArray()->type().get());
+}
+
 template class DecimalArrayFlightSqlAccessor<Decimal128Array, odbcabstraction::CDataType_NUMERIC>;
 
 } // namespace flight_sql
@@ -32,6 +32,8 @@ public:
 
   size_t GetCellLength_impl(ColumnBinding *binding) const;
 
+  void OnArrayChanged_impl();
+
 private:
   Decimal128Type *data_type_;
 };
@@ -0,0 +1,288 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "interval_array_accessor.h"
+
+#include "common.h"
+#include "utils.h"
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using namespace odbcabstraction;
+
+namespace {
+
+constexpr int64_t NANOS_PER_SECOND = 1000000000;
+constexpr int64_t NANOS_PER_MINUTE = 60 * NANOS_PER_SECOND;
+constexpr int64_t NANOS_PER_HOUR = 60 * NANOS_PER_MINUTE;
+// The fraction field counts microseconds, the default seconds precision.
+constexpr int64_t NANOS_PER_FRACTION = 1000;
+
+constexpr int64_t MONTHS_PER_YEAR = 12;
+
+/// SQL_C_INTERVAL_* codes are 100 plus the matching SQL_IS_* value.
+SQLINTERVAL GetIntervalType(CDataType target_type) {
+  return static_cast<SQLINTERVAL>(target_type - 100);
+}
+
+RowStatus FillYearMonthInterval(CDataType target_type, int64_t months,
+                                SQL_INTERVAL_STRUCT &interval) {
+  std::memset(&interval, 0, sizeof(interval));
+  interval.interval_type = GetIntervalType(target_type);
+  interval.interval_sign = months < 0 ? SQL_TRUE : SQL_FALSE;
+
+  const int64_t magnitude = std::abs(months);
+  auto &year_month = interval.intval.year_month;
+  switch (target_type) {
+    case CDataType_INTERVAL_YEAR:
+      year_month.year = static_cast<SQLUINTEGER>(magnitude / MONTHS_PER_YEAR);
+      return magnitude % MONTHS_PER_YEAR ? RowStatus_SUCCESS_WITH_INFO : RowStatus_SUCCESS;
+    case CDataType_INTERVAL_MONTH:
+      year_month.month = static_cast<SQLUINTEGER>(magnitude);
+      return RowStatus_SUCCESS;
+    default:
+      year_month.year = static_cast<SQLUINTEGER>(magnitude / MONTHS_PER_YEAR);
+      year_month.month = static_cast<SQLUINTEGER>(magnitude % MONTHS_PER_YEAR);
+      return RowStatus_SUCCESS;
+  }
+}
+
+RowStatus FillDaySecondInterval(CDataType target_type, int64_t days, int64_t nanoseconds,
+                                SQL_INTERVAL_STRUCT &interval) {
+  NormalizeDayTimeInterval(days, nanoseconds);
+
+  std::memset(&interval, 0, sizeof(interval));
+  interval.interval_type = GetIntervalType(target_type);
+  interval.interval_sign = days < 0 || nanoseconds < 0 ? SQL_TRUE : SQL_FALSE;
+
+  const int64_t abs_days = std::abs(days);
+  const int64_t abs_nanos = std::abs(nanoseconds);
+  const int64_t hours = abs_nanos / NANOS_PER_HOUR;
+  const int64_t minutes = abs_nanos / NANOS_PER_MINUTE % 60;
+  const int64_t seconds = abs_nanos / NANOS_PER_SECOND % 60;
+  const int64_t fraction = abs_nanos % NANOS_PER_SECOND / NANOS_PER_FRACTION;
+
+  // Only the leading field can exceed its natural range, as it absorbs all
+  // larger units.
+  bool fits = true;
+  auto set_leading = [&fits](SQLUINTEGER &field, int64_t value) {
+    fits = value <= std::numeric_limits<SQLUINTEGER>::max();
+    field = static_cast<SQLUINTEGER>(value);
+  };
+
+  auto &day_second = interval.intval.day_second;
+  int64_t dropped_nanos;
+  switch (target_type) {
+    case CDataType_INTERVAL_DAY:
+      set_leading(day_second.day, abs_days);
+      dropped_nanos = abs_nanos;
+      break;
+    case CDataType_INTERVAL_HOUR:
+      set_leading(day_second.hour, abs_days * 24 + hours);
+      dropped_nanos = abs_nanos % NANOS_PER_HOUR;
+      break;
+    case CDataType_INTERVAL_MINUTE:
+      set_leading(day_second.minute, abs_days * 24 * 60 + abs_nanos / NANOS_PER_MINUTE);
+      dropped_nanos = abs_nanos % NANOS_PER_MINUTE;
+      break;
+    case CDataType_INTERVAL_SECOND:
+      set_leading(day_second.second, abs_days * 24 * 60 * 60 + abs_nanos / NANOS_PER_SECOND);
+      day_second.fraction = static_cast<SQLUINTEGER>(fraction);
+      dropped_nanos = abs_nanos % NANOS_PER_FRACTION;
+      break;
+    case CDataType_INTERVAL_DAY_TO_HOUR:
+      set_leading(day_second.day, abs_days);
+      day_second.hour = static_cast<SQLUINTEGER>(hours);
+      dropped_nanos = abs_nanos % NANOS_PER_HOUR;
+      break;
+    case CDataType_INTERVAL_DAY_TO_MINUTE:
+      set_leading(day_second.day, abs_days);
+      day_second.hour = static_cast<SQLUINTEGER>(hours);
+      day_second.minute = static_cast<SQLUINTEGER>(minutes);
+      dropped_nanos = abs_nanos % NANOS_PER_MINUTE;
+      break;
+    case CDataType_INTERVAL_DAY_TO_SECOND:
+      set_leading(day_second.day, abs_days);
+      day_second.hour = static_cast<SQLUINTEGER>(hours);
+      day_second.minute = static_cast<SQLUINTEGER>(minutes);
+      day_second.second = static_cast<SQLUINTEGER>(seconds);
+      day_second.fraction = static_cast<SQLUINTEGER>(fraction);
+      dropped_nanos = abs_nanos % NANOS_PER_FRACTION;
+      break;
+    case CDataType_INTERVAL_HOUR_TO_MINUTE:
+      set_leading(day_second.hour, abs_days * 24 + hours);
+      day_second.minute = static_cast<SQLUINTEGER>(minutes);
+      dropped_nanos = abs_nanos % NANOS_PER_MINUTE;
+      break;
+    case CDataType_INTERVAL_HOUR_TO_SECOND:
+      set_leading(day_second.hour, abs_days * 24 + hours);
+      day_second.minute = static_cast<SQLUINTEGER>(minutes);
+      day_second.second = static_cast<SQLUINTEGER>(seconds);
+      day_second.fraction = static_cast<SQLUINTEGER>(fraction);
+      dropped_nanos = abs_nanos % NANOS_PER_FRACTION;
+      break;
+    default:
+      set_leading(day_second.minute, abs_days * 24 * 60 + abs_nanos / NANOS_PER_MINUTE);
+      day_second.second = static_cast<SQLUINTEGER>(seconds);
+      day_second.fraction = static_cast<SQLUINTEGER>(fraction);
+      dropped_nanos = abs_nanos % NANOS_PER_FRACTION;
+      break;
+  }
+
+  if (!fits) {
+    return RowStatus_ERROR;
+  }
+  return dropped_nanos != 0 ? RowStatus_SUCCESS_WITH_INFO : RowStatus_SUCCESS;
+}
+
+RowStatus FillInterval(MonthIntervalArray *array, int64_t row, CDataType target_type,
+                       SQL_INTERVAL_STRUCT &interval) {
+  return FillYearMonthInterval(target_type, array->Value(row), interval);
+}
+
+RowStatus FillInterval(DayTimeIntervalArray *array, int64_t row, CDataType target_type,
+                       SQL_INTERVAL_STRUCT &interval) {
+  const auto value = array->GetValue(row);
+  return FillDaySecondInterval(target_type, value.days,
+                               static_cast<int64_t>(value.milliseconds) * 1000000, interval);
+}
+
+RowStatus FillInterval(MonthDayNanoIntervalArray *array, int64_t row, CDataType target_type,
+                       SQL_INTERVAL_STRUCT &interval) {
+  const auto value = array->GetValue(row);
+  // Months have no fixed length in days, so they cannot be expressed.
+  if (value.months != 0) {
+    return RowStatus_ERROR;
+  }
+  return FillDaySecondInterval(target_type, value.days, value.nanoseconds, interval);
+}
+
+template <typename ARROW_ARRAY>
+Accessor* CreateDaySecondIntervalAccessor(arrow::Array *array, CDataType target_type) {
+  switch (target_type) {
+    case CDataType_INTERVAL_DAY:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_DAY>(array);
+    case CDataType_INTERVAL_HOUR:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_HOUR>(array);
+    case CDataType_INTERVAL_MINUTE:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_MINUTE>(array);
+    case CDataType_INTERVAL_SECOND:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_SECOND>(array);
+    case CDataType_INTERVAL_DAY_TO_HOUR:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_DAY_TO_HOUR>(array);
+    case CDataType_INTERVAL_DAY_TO_MINUTE:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_DAY_TO_MINUTE>(array);
+    case CDataType_INTERVAL_DAY_TO_SECOND:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_DAY_TO_SECOND>(array);
+    case CDataType_INTERVAL_HOUR_TO_MINUTE:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_HOUR_TO_MINUTE>(array);
+    case CDataType_INTERVAL_HOUR_TO_SECOND:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_HOUR_TO_SECOND>(array);
+    case CDataType_INTERVAL_MINUTE_TO_SECOND:
+      return new IntervalArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_INTERVAL_MINUTE_TO_SECOND>(array);
+    default:
+      throw DriverException("Cannot convert a day-time interval to a year-month interval",
+                            "07006");
+  }
+}
+
+} // namespace
+
+template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
+IntervalArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>::IntervalArrayFlightSqlAccessor(
+    Array *array)
+    : FlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE,
+                        IntervalArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>>(array) {}
+
+template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
+size_t IntervalArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>::GetColumnarData_impl(
+    ColumnBinding *binding, int64_t starting_row, int64_t cells, int64_t &value_offset,
+    bool update_value_offset, odbcabstraction::Diagnostics &diagnostics,
+    uint16_t* row_status_array) {
+  auto *array = this->GetArray();
+
+  for (int64_t i = 0; i < cells; ++i) {
+    const int64_t current_arrow_row = starting_row + i;
+    if (array->IsNull(current_arrow_row)) {
+      if (!binding->strlen_buffer) {
+        throw NullWithoutIndicatorException();
+      }
+      *binding->GetCellIndicator(i) = NULL_DATA;
+      continue;
+    }
+
+    auto *buffer = static_cast<SQL_INTERVAL_STRUCT *>(
+        binding->GetCellBuffer(i, sizeof(SQL_INTERVAL_STRUCT)));
+    const RowStatus row_status = FillInterval(array, current_arrow_row, TARGET_TYPE, *buffer);
+
+    if (row_status == RowStatus_ERROR) {
+      // Without a row status array there is no way to fail a single row.
+      if (!row_status_array) {
+        throw DriverException("Interval field overflow", "22015");
+      }
+      MarkRowStatus(row_status_array, i, RowStatus_ERROR);
+      diagnostics.AddCoalescedWarning("Error in row: interval field overflow", "01S01",
+                                      ODBCErrorCodes_GENERAL_WARNING);
+      continue;
+    }
+
+    if (binding->strlen_buffer) {
+      *binding->GetCellIndicator(i) = sizeof(SQL_INTERVAL_STRUCT);
+    }
+    if (row_status == RowStatus_SUCCESS_WITH_INFO) {
+      diagnostics.AddCoalescedWarning("Fractional truncation", "01S07",
+                                      ODBCErrorCodes_FRACTIONAL_TRUNCATION_WARNING);
+      MarkRowStatus(row_status_array, i, RowStatus_SUCCESS_WITH_INFO);
+    }
+  }
+
+  return static_cast<size_t>(cells);
+}
+
+template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
+size_t IntervalArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>::GetCellLength_impl(
+    ColumnBinding *binding) const {
+  return sizeof(SQL_INTERVAL_STRUCT);
+}
+
+Accessor* CreateIntervalAccessor(arrow::Array *array, CDataType target_type) {
+  switch (array->type_id()) {
+    case arrow::Type::INTERVAL_MONTHS:
+      switch (target_type) {
+        case CDataType_INTERVAL_YEAR:
+          return new IntervalArrayFlightSqlAccessor<MonthIntervalArray, CDataType_INTERVAL_YEAR>(array);
+        case CDataType_INTERVAL_MONTH:
+          return new IntervalArrayFlightSqlAccessor<MonthIntervalArray, CDataType_INTERVAL_MONTH>(array);
+        case CDataType_INTERVAL_YEAR_TO_MONTH:
+          return new IntervalArrayFlightSqlAccessor<MonthIntervalArray,
+                                                    CDataType_INTERVAL_YEAR_TO_MONTH>(array);
+        default:
+          throw DriverException("Cannot convert a year-month interval to a day-time interval",
+                                "07006");
+      }
+    case arrow::Type::INTERVAL_DAY_TIME:
+      return CreateDaySecondIntervalAccessor<DayTimeIntervalArray>(array, target_type);
+    case arrow::Type::INTERVAL_MONTH_DAY_NANO:
+      return CreateDaySecondIntervalAccessor<MonthDayNanoIntervalArray>(array, target_type);
+    default:
+      throw DriverException("Unsupported input supplied to CreateIntervalAccessor");
+  }
+}
+
+template class IntervalArrayFlightSqlAccessor<MonthIntervalArray, CDataType_INTERVAL_YEAR>;
+template class IntervalArrayFlightSqlAccessor<MonthIntervalArray, CDataType_INTERVAL_MONTH>;
+template class IntervalArrayFlightSqlAccessor<MonthIntervalArray, CDataType_INTERVAL_YEAR_TO_MONTH>;
+template class IntervalArrayFlightSqlAccessor<DayTimeIntervalArray, CDataType_INTERVAL_DAY_TO_SECOND>;
+template class IntervalArrayFlightSqlAccessor<MonthDayNanoIntervalArray, CDataType_INTERVAL_DAY_TO_SECOND>;
+
+} // namespace flight_sql
+} // namespace driver
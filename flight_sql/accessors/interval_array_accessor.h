@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include "types.h"
+#include <arrow/array.h>
+#include <odbcabstraction/platform.h>
+#include <odbcabstraction/types.h>
+#include <sql.h>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using namespace odbcabstraction;
+
+/// \brief Accessor filling SQL_INTERVAL_STRUCT from Arrow interval arrays.
+/// INTERVAL_MONTHS arrays serve the year-month C types. INTERVAL_DAY_TIME and
+/// INTERVAL_MONTH_DAY_NANO arrays serve the day-time C types. The leading
+/// field absorbs larger units, and the fraction holds microseconds, the
+/// default interval seconds precision. Dropped smaller units report 01S07.
+/// Values that do not fit, including month-day-nano values with months, fail
+/// only their row.
+template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
+class IntervalArrayFlightSqlAccessor
+    : public FlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE,
+                               IntervalArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>> {
+public:
+  explicit IntervalArrayFlightSqlAccessor(Array *array);
+
+  size_t GetColumnarData_impl(ColumnBinding *binding, int64_t starting_row, int64_t cells,
+                              int64_t &value_offset, bool update_value_offset,
+                              odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array);
+
+  size_t GetCellLength_impl(ColumnBinding *binding) const;
+};
+
+/// \brief Creates an accessor converting an interval array to an interval C
+/// type of the same family.
+Accessor* CreateIntervalAccessor(arrow::Array *array, CDataType target_type);
+
+} // namespace flight_sql
+} // namespace driver
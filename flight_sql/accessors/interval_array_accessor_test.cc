@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "arrow/builder.h"
+#include "arrow/testing/builder.h"
+#include "interval_array_accessor.h"
+#include "gtest/gtest.h"
+#include <odbcabstraction/diagnostics.h>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using namespace odbcabstraction;
+
+TEST(IntervalArrayFlightSqlAccessor, Test_Months_CDataType_INTERVAL_YEAR_TO_MONTH) {
+  std::vector<int32_t> values = {14, -25, 0};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<MonthIntervalType, int32_t>(values, &array);
+
+  IntervalArrayFlightSqlAccessor<MonthIntervalArray, CDataType_INTERVAL_YEAR_TO_MONTH> accessor(
+      array.get());
+
+  std::vector<SQL_INTERVAL_STRUCT> buffer(values.size());
+  std::vector<ssize_t> strlen_buffer(values.size());
+  ColumnBinding binding(CDataType_INTERVAL_YEAR_TO_MONTH, 0, 0, buffer.data(), 0,
+                        strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(values.size(), accessor.GetColumnarData(&binding, 0, values.size(), value_offset,
+                                                    false, diagnostics, nullptr));
+
+  ASSERT_EQ(sizeof(SQL_INTERVAL_STRUCT), strlen_buffer[0]);
+  ASSERT_EQ(SQL_IS_YEAR_TO_MONTH, buffer[0].interval_type);
+  ASSERT_EQ(SQL_FALSE, buffer[0].interval_sign);
+  ASSERT_EQ(1, buffer[0].intval.year_month.year);
+  ASSERT_EQ(2, buffer[0].intval.year_month.month);
+  ASSERT_EQ(SQL_TRUE, buffer[1].interval_sign);
+  ASSERT_EQ(2, buffer[1].intval.year_month.year);
+  ASSERT_EQ(1, buffer[1].intval.year_month.month);
+  ASSERT_EQ(0, buffer[2].intval.year_month.year);
+  ASSERT_EQ(0, diagnostics.GetRecordCount());
+}
+
+TEST(IntervalArrayFlightSqlAccessor, Test_DayTime_CDataType_INTERVAL_DAY_TO_SECOND) {
+  DayTimeIntervalBuilder builder;
+  ASSERT_TRUE(builder.Append({1, 3723500}).ok());
+  ASSERT_TRUE(builder.Append({0, -1500}).ok());
+  ASSERT_TRUE(builder.AppendNull().ok());
+  std::shared_ptr<Array> array;
+  ASSERT_TRUE(builder.Finish(&array).ok());
+
+  IntervalArrayFlightSqlAccessor<DayTimeIntervalArray, CDataType_INTERVAL_DAY_TO_SECOND> accessor(
+      array.get());
+
+  std::vector<SQL_INTERVAL_STRUCT> buffer(3);
+  std::vector<ssize_t> strlen_buffer(3);
+  ColumnBinding binding(CDataType_INTERVAL_DAY_TO_SECOND, 0, 0, buffer.data(), 0,
+                        strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(3, accessor.GetColumnarData(&binding, 0, 3, value_offset, false, diagnostics,
+                                        nullptr));
+
+  ASSERT_EQ(SQL_IS_DAY_TO_SECOND, buffer[0].interval_type);
+  ASSERT_EQ(SQL_FALSE, buffer[0].interval_sign);
+  ASSERT_EQ(1, buffer[0].intval.day_second.day);
+  ASSERT_EQ(1, buffer[0].intval.day_second.hour);
+  ASSERT_EQ(2, buffer[0].intval.day_second.minute);
+  ASSERT_EQ(3, buffer[0].intval.day_second.second);
+  ASSERT_EQ(500000, buffer[0].intval.day_second.fraction);
+
+  ASSERT_EQ(SQL_TRUE, buffer[1].interval_sign);
+  ASSERT_EQ(0, buffer[1].intval.day_second.day);
+  ASSERT_EQ(1, buffer[1].intval.day_second.second);
+  ASSERT_EQ(500000, buffer[1].intval.day_second.fraction);
+
+  ASSERT_EQ(odbcabstraction::NULL_DATA, strlen_buffer[2]);
+}
+
+TEST(IntervalArrayFlightSqlAccessor, Test_MonthDayNano_TruncationAndMonths) {
+  MonthDayNanoIntervalBuilder builder;
+  ASSERT_TRUE(builder.Append({0, 2, 1}).ok());
+  ASSERT_TRUE(builder.Append({1, 0, 0}).ok());
+  std::shared_ptr<Array> array;
+  ASSERT_TRUE(builder.Finish(&array).ok());
+
+  std::unique_ptr<Accessor> accessor(
+      CreateIntervalAccessor(array.get(), CDataType_INTERVAL_DAY_TO_SECOND));
+
+  std::vector<SQL_INTERVAL_STRUCT> buffer(2);
+  std::vector<ssize_t> strlen_buffer(2);
+  std::vector<uint16_t> row_status(2, odbcabstraction::RowStatus_SUCCESS);
+  ColumnBinding binding(CDataType_INTERVAL_DAY_TO_SECOND, 0, 0, buffer.data(), 0,
+                        strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(2, accessor->GetColumnarData(&binding, 0, 2, value_offset, false, diagnostics,
+                                         row_status.data()));
+
+  // The single nanosecond does not fit the microsecond fraction.
+  ASSERT_EQ(odbcabstraction::RowStatus_SUCCESS_WITH_INFO, row_status[0]);
+  ASSERT_EQ(2, buffer[0].intval.day_second.day);
+  ASSERT_EQ("01S07", diagnostics.GetSQLState(0));
+  ASSERT_EQ(odbcabstraction::RowStatus_ERROR, row_status[1]);
+  ASSERT_EQ("01S01", diagnostics.GetSQLState(1));
+
+  ASSERT_THROW(CreateIntervalAccessor(array.get(), CDataType_INTERVAL_YEAR), DriverException);
+}
+
+} // namespace flight_sql
+} // namespace driver
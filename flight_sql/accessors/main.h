@@ -13,5 +13,7 @@
 #include "time_array_accessor.h"
 #include "timestamp_array_accessor.h"
 #include "decimal_array_accessor.h"
+#include "interval_array_accessor.h"
 #include "primitive_array_accessor.h"
 #include "string_array_accessor.h"
+#include "string_to_temporal_accessor.h"
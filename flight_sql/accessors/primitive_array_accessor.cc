@@ -7,12 +7,69 @@
 
 #include "primitive_array_accessor.h"
 
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 namespace driver {
 namespace flight_sql {
 
 using namespace arrow;
 using namespace odbcabstraction;
 
+namespace {
+
+/// Whether every SOURCE value is representable as TARGET, which lets the
+/// conversion skip range checks entirely.
+template <typename SOURCE, typename TARGET>
+constexpr bool IsWideningConversion() {
+  if (std::is_floating_point<TARGET>::value) {
+    return std::is_integral<SOURCE>::value || sizeof(TARGET) >= sizeof(SOURCE);
+  }
+  if (std::is_floating_point<SOURCE>::value) {
+    return false;
+  }
+  if (std::is_signed<SOURCE>::value == std::is_signed<TARGET>::value) {
+    return sizeof(TARGET) >= sizeof(SOURCE);
+  }
+  return std::is_unsigned<SOURCE>::value && sizeof(TARGET) > sizeof(SOURCE);
+}
+
+template <typename TARGET, typename SOURCE>
+bool IsInTargetRange(SOURCE value) {
+  if constexpr (IsWideningConversion<SOURCE, TARGET>()) {
+    return true;
+  } else if constexpr (std::is_floating_point<TARGET>::value) {
+    // Narrowing double to float. Infinities and NaN carry over unchanged.
+    return !std::isfinite(value) ||
+           std::fabs(value) <= std::numeric_limits<TARGET>::max();
+  } else if constexpr (std::is_floating_point<SOURCE>::value) {
+    // Floating point values are truncated towards zero. The exclusive upper
+    // bound 2^digits is exact in floating point even for 64-bit targets.
+    // NaN fails both comparisons.
+    const SOURCE truncated = std::trunc(value);
+    const SOURCE upper = std::ldexp(SOURCE(1), std::numeric_limits<TARGET>::digits);
+    const SOURCE lower = std::is_signed<TARGET>::value ? -upper : SOURCE(0);
+    return truncated >= lower && truncated < upper;
+  } else if constexpr (std::is_signed<SOURCE>::value) {
+    // Signed to unsigned, or signed to a narrower signed type.
+    if (value < 0) {
+      if constexpr (std::is_signed<TARGET>::value) {
+        return value >= std::numeric_limits<TARGET>::min();
+      }
+      return false;
+    }
+    return static_cast<typename std::make_unsigned<SOURCE>::type>(value) <=
+           std::numeric_limits<TARGET>::max();
+  } else {
+    // Unsigned to a narrower or signed type.
+    return value <= static_cast<typename std::make_unsigned<TARGET>::type>(
+                        std::numeric_limits<TARGET>::max());
+  }
+}
+
+} // namespace
+
 template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
 PrimitiveArrayFlightSqlAccessor<
     ARROW_ARRAY, TARGET_TYPE>::PrimitiveArrayFlightSqlAccessor(Array *array)
@@ -26,34 +83,176 @@ PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>::GetColumnarData_impl(
     ColumnBinding *binding, int64_t starting_row,
     int64_t cells, int64_t &value_offset, bool update_value_offset,
     odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array) {
-  return CopyFromArrayValuesToBinding<ARROW_ARRAY>(this->GetArray(), binding, starting_row, cells);
+  if constexpr (std::is_same<SourceCType, TargetCType>::value) {
+    return CopyFromArrayValuesToBinding<ARROW_ARRAY>(this->GetArray(), binding, starting_row, cells);
+  } else {
+    return ConvertValuesToBinding(binding, starting_row, cells, diagnostics, row_status_array);
+  }
+}
+
+template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
+size_t
+PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>::ConvertValuesToBinding(
+    ColumnBinding *binding, int64_t starting_row, int64_t cells,
+    odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array) {
+  auto *array = this->GetArray();
+  const SourceCType *values = array->raw_values() + starting_row;
+
+  if constexpr (IsWideningConversion<SourceCType, TargetCType>()) {
+    // Nothing can go out of range, so fill the indicators the same way a
+    // plain copy does and convert in a single branch-free loop.
+    for (int64_t i = 0; i < cells; ++i) {
+      if (array->IsNull(starting_row + i)) {
+        if (!binding->strlen_buffer) {
+          throw odbcabstraction::NullWithoutIndicatorException();
+        }
+        *binding->GetCellIndicator(i) = NULL_DATA;
+      } else if (binding->strlen_buffer) {
+        *binding->GetCellIndicator(i) = sizeof(TargetCType);
+      }
+    }
+    if (binding->row_stride) {
+      for (int64_t i = 0; i < cells; ++i) {
+        *static_cast<TargetCType *>(binding->GetCellBuffer(i, sizeof(TargetCType))) =
+            static_cast<TargetCType>(values[i]);
+      }
+    } else {
+      auto *buffer = static_cast<TargetCType *>(binding->buffer);
+      for (int64_t i = 0; i < cells; ++i) {
+        buffer[i] = static_cast<TargetCType>(values[i]);
+      }
+    }
+    return cells;
+  }
+
+  for (int64_t i = 0; i < cells; ++i) {
+    if (array->IsNull(starting_row + i)) {
+      if (!binding->strlen_buffer) {
+        throw odbcabstraction::NullWithoutIndicatorException();
+      }
+      *binding->GetCellIndicator(i) = NULL_DATA;
+      continue;
+    }
+
+    const SourceCType value = values[i];
+    if (!IsInTargetRange<TargetCType>(value)) {
+      // Without a row status array there is no way to fail a single row.
+      if (!row_status_array) {
+        throw DriverException("Numeric value out of range", "22003");
+      }
+      MarkRowStatus(row_status_array, i, RowStatus_ERROR);
+      diagnostics.AddCoalescedWarning("Error in row: numeric value out of range", "01S01",
+                                      ODBCErrorCodes_GENERAL_WARNING);
+      continue;
+    }
+
+    const auto converted = static_cast<TargetCType>(value);
+    *static_cast<TargetCType *>(binding->GetCellBuffer(i, sizeof(TargetCType))) = converted;
+    if (binding->strlen_buffer) {
+      *binding->GetCellIndicator(i) = sizeof(TargetCType);
+    }
+
+    if constexpr (std::is_floating_point<SourceCType>::value &&
+                  std::is_integral<TargetCType>::value) {
+      if (static_cast<SourceCType>(converted) != value) {
+        diagnostics.AddCoalescedWarning("Fractional truncation", "01S07",
+                                        ODBCErrorCodes_FRACTIONAL_TRUNCATION_WARNING);
+        MarkRowStatus(row_status_array, i, RowStatus_SUCCESS_WITH_INFO);
+      }
+    }
+  }
+
+  return cells;
 }
 
 template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
 size_t PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE>::GetCellLength_impl(ColumnBinding *binding) const {
-  return sizeof(typename ARROW_ARRAY::TypeClass::c_type);
+  return sizeof(TargetCType);
 }
 
-template class PrimitiveArrayFlightSqlAccessor<
-    Int64Array, odbcabstraction::CDataType_SBIGINT>;
-template class PrimitiveArrayFlightSqlAccessor<
-    Int32Array, odbcabstraction::CDataType_SLONG>;
-template class PrimitiveArrayFlightSqlAccessor<
-    Int16Array, odbcabstraction::CDataType_SSHORT>;
-template class PrimitiveArrayFlightSqlAccessor<
-    Int8Array, odbcabstraction::CDataType_STINYINT>;
-template class PrimitiveArrayFlightSqlAccessor<
-    UInt64Array, odbcabstraction::CDataType_UBIGINT>;
-template class PrimitiveArrayFlightSqlAccessor<
-    UInt32Array, odbcabstraction::CDataType_ULONG>;
-template class PrimitiveArrayFlightSqlAccessor<
-    UInt16Array, odbcabstraction::CDataType_USHORT>;
-template class PrimitiveArrayFlightSqlAccessor<
-    UInt8Array, odbcabstraction::CDataType_UTINYINT>;
-template class PrimitiveArrayFlightSqlAccessor<
-    DoubleArray, odbcabstraction::CDataType_DOUBLE>;
-template class PrimitiveArrayFlightSqlAccessor<
-    FloatArray, odbcabstraction::CDataType_FLOAT>;
+namespace {
+template <typename ARROW_ARRAY>
+Accessor* CreateNumericAccessorForTarget(arrow::Array *array, CDataType target_type) {
+  switch (target_type) {
+  case CDataType_STINYINT:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_STINYINT>(array);
+  case CDataType_UTINYINT:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_UTINYINT>(array);
+  case CDataType_SSHORT:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_SSHORT>(array);
+  case CDataType_USHORT:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_USHORT>(array);
+  case CDataType_SLONG:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_SLONG>(array);
+  case CDataType_ULONG:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_ULONG>(array);
+  case CDataType_SBIGINT:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_SBIGINT>(array);
+  case CDataType_UBIGINT:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_UBIGINT>(array);
+  case CDataType_FLOAT:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_FLOAT>(array);
+  case CDataType_DOUBLE:
+    return new PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_DOUBLE>(array);
+  default:
+    throw DriverException("Unsupported input supplied to CreateNumericAccessor");
+  }
+}
+} // namespace
+
+Accessor* CreateNumericAccessor(arrow::Array *array, CDataType target_type) {
+  switch (array->type_id()) {
+  case arrow::Type::INT8:
+    return CreateNumericAccessorForTarget<Int8Array>(array, target_type);
+  case arrow::Type::UINT8:
+    return CreateNumericAccessorForTarget<UInt8Array>(array, target_type);
+  case arrow::Type::INT16:
+    return CreateNumericAccessorForTarget<Int16Array>(array, target_type);
+  case arrow::Type::UINT16:
+    return CreateNumericAccessorForTarget<UInt16Array>(array, target_type);
+  case arrow::Type::INT32:
+    return CreateNumericAccessorForTarget<Int32Array>(array, target_type);
+  case arrow::Type::UINT32:
+    return CreateNumericAccessorForTarget<UInt32Array>(array, target_type);
+  case arrow::Type::INT64:
+    return CreateNumericAccessorForTarget<Int64Array>(array, target_type);
+  case arrow::Type::UINT64:
+    return CreateNumericAccessorForTarget<UInt64Array>(array, target_type);
+  case arrow::Type::FLOAT:
+    return CreateNumericAccessorForTarget<FloatArray>(array, target_type);
+  case arrow::Type::DOUBLE:
+    return CreateNumericAccessorForTarget<DoubleArray>(array, target_type);
+  default:
+    throw DriverException("Unsupported input supplied to CreateNumericAccessor");
+  }
+}
+
+// Every source/target pair CreateNumericAccessor can return, which is also
+// what tests construct directly.
+#define INSTANTIATE_NUMERIC_ACCESSORS(ARROW_ARRAY)                                 \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_STINYINT>; \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_UTINYINT>; \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_SSHORT>;   \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_USHORT>;   \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_SLONG>;    \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_ULONG>;    \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_SBIGINT>;  \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_UBIGINT>;  \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_FLOAT>;    \
+  template class PrimitiveArrayFlightSqlAccessor<ARROW_ARRAY, CDataType_DOUBLE>;
+
+INSTANTIATE_NUMERIC_ACCESSORS(Int8Array)
+INSTANTIATE_NUMERIC_ACCESSORS(UInt8Array)
+INSTANTIATE_NUMERIC_ACCESSORS(Int16Array)
+INSTANTIATE_NUMERIC_ACCESSORS(UInt16Array)
+INSTANTIATE_NUMERIC_ACCESSORS(Int32Array)
+INSTANTIATE_NUMERIC_ACCESSORS(UInt32Array)
+INSTANTIATE_NUMERIC_ACCESSORS(Int64Array)
+INSTANTIATE_NUMERIC_ACCESSORS(UInt64Array)
+INSTANTIATE_NUMERIC_ACCESSORS(FloatArray)
+INSTANTIATE_NUMERIC_ACCESSORS(DoubleArray)
+
+#undef INSTANTIATE_NUMERIC_ACCESSORS
 
 } // namespace flight_sql
 } // namespace driver
@@ -20,6 +20,30 @@ namespace flight_sql {
 using namespace arrow;
 using namespace odbcabstraction;
 
+/// \brief Maps a numeric ODBC C type to the C++ type written to bound buffers.
+template <CDataType TARGET_TYPE>
+struct NumericCDataTypeTraits;
+
+#define NUMERIC_C_DATA_TYPE_TRAITS(C_DATA_TYPE, C_TYPE) \
+  template <> struct NumericCDataTypeTraits<C_DATA_TYPE> { typedef C_TYPE c_type; }
+
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_STINYINT, int8_t);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_UTINYINT, uint8_t);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_SSHORT, int16_t);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_USHORT, uint16_t);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_SLONG, int32_t);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_ULONG, uint32_t);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_SBIGINT, int64_t);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_UBIGINT, uint64_t);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_FLOAT, float);
+NUMERIC_C_DATA_TYPE_TRAITS(CDataType_DOUBLE, double);
+
+#undef NUMERIC_C_DATA_TYPE_TRAITS
+
+/// \brief Accessor for integer and floating point arrays. When the Arrow and
+/// ODBC C types differ, values are converted while being copied to the bound
+/// buffer rather than through an intermediate casted array. Values outside the
+/// range of the target type fail only the rows holding them.
 template <typename ARROW_ARRAY, CDataType TARGET_TYPE>
 class PrimitiveArrayFlightSqlAccessor
     : public FlightSqlAccessor<
@@ -33,7 +57,17 @@ public:
                               odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array);
 
   size_t GetCellLength_impl(ColumnBinding *binding) const;
+
+private:
+  typedef typename ARROW_ARRAY::TypeClass::c_type SourceCType;
+  typedef typename NumericCDataTypeTraits<TARGET_TYPE>::c_type TargetCType;
+
+  size_t ConvertValuesToBinding(ColumnBinding *binding, int64_t starting_row, int64_t cells,
+                                odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array);
 };
 
+/// \brief Creates an accessor converting a numeric array to any numeric C type.
+Accessor* CreateNumericAccessor(arrow::Array *array, CDataType target_type);
+
 } // namespace flight_sql
 } // namespace driver
@@ -85,5 +85,145 @@ TEST(PrimitiveArrayFlightSqlAccessor, Test_DoubleArray_CDataType_DOUBLE) {
   TestPrimitiveArraySqlAccessor<DoubleArray, CDataType_DOUBLE>();
 }
 
+TEST(PrimitiveArrayFlightSqlAccessor, Test_Int32Array_CDataType_SBIGINT) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true},
+                                      {-2147483647 - 1, 0, 2147483647}, &array);
+
+  PrimitiveArrayFlightSqlAccessor<Int32Array, CDataType_SBIGINT> accessor(array.get());
+
+  std::vector<int64_t> buffer(3);
+  std::vector<ssize_t> strlen_buffer(3);
+  ColumnBinding binding(CDataType_SBIGINT, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  driver::odbcabstraction::Diagnostics diagnostics("Dummy", "Dummy", odbcabstraction::V_3);
+  ASSERT_EQ(3, accessor.GetColumnarData(&binding, 0, 3, value_offset, false, diagnostics, nullptr));
+
+  ASSERT_EQ(sizeof(int64_t), accessor.GetCellLength(&binding));
+  ASSERT_EQ(sizeof(int64_t), strlen_buffer[0]);
+  ASSERT_EQ(-2147483648LL, buffer[0]);
+  ASSERT_EQ(odbcabstraction::NULL_DATA, strlen_buffer[1]);
+  ASSERT_EQ(sizeof(int64_t), strlen_buffer[2]);
+  ASSERT_EQ(2147483647LL, buffer[2]);
+}
+
+TEST(PrimitiveArrayFlightSqlAccessor, Test_Int64Array_CDataType_DOUBLE) {
+  std::vector<int64_t> values = {-3, 0, 1LL << 40};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type>(values, &array);
+
+  PrimitiveArrayFlightSqlAccessor<Int64Array, CDataType_DOUBLE> accessor(array.get());
+
+  std::vector<double> buffer(values.size());
+  std::vector<ssize_t> strlen_buffer(values.size());
+  ColumnBinding binding(CDataType_DOUBLE, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  driver::odbcabstraction::Diagnostics diagnostics("Dummy", "Dummy", odbcabstraction::V_3);
+  ASSERT_EQ(values.size(),
+            accessor.GetColumnarData(&binding, 0, values.size(), value_offset, false, diagnostics, nullptr));
+
+  for (int i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(sizeof(double), strlen_buffer[i]);
+    ASSERT_EQ(static_cast<double>(values[i]), buffer[i]);
+  }
+}
+
+TEST(PrimitiveArrayFlightSqlAccessor, Test_Int64Array_CDataType_SSHORT_OutOfRange) {
+  std::vector<int64_t> values = {1, 40000, -32768};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type>(values, &array);
+
+  PrimitiveArrayFlightSqlAccessor<Int64Array, CDataType_SSHORT> accessor(array.get());
+
+  std::vector<int16_t> buffer(values.size());
+  std::vector<ssize_t> strlen_buffer(values.size());
+  std::vector<uint16_t> row_status(values.size(), odbcabstraction::RowStatus_SUCCESS);
+  ColumnBinding binding(CDataType_SSHORT, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  driver::odbcabstraction::Diagnostics diagnostics("Dummy", "Dummy", odbcabstraction::V_3);
+  ASSERT_EQ(values.size(),
+            accessor.GetColumnarData(&binding, 0, values.size(), value_offset, false, diagnostics, row_status.data()));
+
+  // Only the row that does not fit fails.
+  ASSERT_EQ(odbcabstraction::RowStatus_SUCCESS, row_status[0]);
+  ASSERT_EQ(1, buffer[0]);
+  ASSERT_EQ(odbcabstraction::RowStatus_ERROR, row_status[1]);
+  ASSERT_EQ(odbcabstraction::RowStatus_SUCCESS, row_status[2]);
+  ASSERT_EQ(-32768, buffer[2]);
+  ASSERT_TRUE(diagnostics.HasWarning());
+  ASSERT_EQ("01S01", diagnostics.GetSQLState(0));
+
+  // A single row fetch without a row status array fails as a whole.
+  ASSERT_THROW(accessor.GetColumnarData(&binding, 1, 1, value_offset, false, diagnostics, nullptr),
+               DriverException);
+}
+
+TEST(PrimitiveArrayFlightSqlAccessor, Test_DoubleArray_CDataType_SLONG_FractionalTruncation) {
+  std::vector<double> values = {2.0, -2.5};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<DoubleType>(values, &array);
+
+  PrimitiveArrayFlightSqlAccessor<DoubleArray, CDataType_SLONG> accessor(array.get());
+
+  std::vector<int32_t> buffer(values.size());
+  std::vector<ssize_t> strlen_buffer(values.size());
+  std::vector<uint16_t> row_status(values.size(), odbcabstraction::RowStatus_SUCCESS);
+  ColumnBinding binding(CDataType_SLONG, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  driver::odbcabstraction::Diagnostics diagnostics("Dummy", "Dummy", odbcabstraction::V_3);
+  ASSERT_EQ(values.size(),
+            accessor.GetColumnarData(&binding, 0, values.size(), value_offset, false, diagnostics, row_status.data()));
+
+  ASSERT_EQ(2, buffer[0]);
+  ASSERT_EQ(odbcabstraction::RowStatus_SUCCESS, row_status[0]);
+  ASSERT_EQ(-2, buffer[1]);
+  ASSERT_EQ(odbcabstraction::RowStatus_SUCCESS_WITH_INFO, row_status[1]);
+  ASSERT_EQ("01S07", diagnostics.GetSQLState(0));
+}
+
+TEST(PrimitiveArrayFlightSqlAccessor, Test_RowWiseBinding) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {7, 0, -9}, &array);
+
+  struct Row {
+    int64_t converted;
+    ssize_t converted_indicator;
+    int32_t copied;
+    ssize_t copied_indicator;
+  };
+  std::vector<Row> rows(3);
+
+  driver::odbcabstraction::Diagnostics diagnostics("Dummy", "Dummy", odbcabstraction::V_3);
+  int64_t value_offset = 0;
+
+  PrimitiveArrayFlightSqlAccessor<Int32Array, CDataType_SBIGINT> converting_accessor(array.get());
+  ColumnBinding converted_binding(CDataType_SBIGINT, 0, 0, &rows[0].converted, 0,
+                                  &rows[0].converted_indicator);
+  converted_binding.row_stride = sizeof(Row);
+  ASSERT_EQ(3, converting_accessor.GetColumnarData(&converted_binding, 0, 3, value_offset, false,
+                                                   diagnostics, nullptr));
+
+  PrimitiveArrayFlightSqlAccessor<Int32Array, CDataType_SLONG> copying_accessor(array.get());
+  ColumnBinding copied_binding(CDataType_SLONG, 0, 0, &rows[0].copied, 0,
+                               &rows[0].copied_indicator);
+  copied_binding.row_stride = sizeof(Row);
+  ASSERT_EQ(3, copying_accessor.GetColumnarData(&copied_binding, 0, 3, value_offset, false,
+                                                diagnostics, nullptr));
+
+  ASSERT_EQ(7, rows[0].converted);
+  ASSERT_EQ(sizeof(int64_t), rows[0].converted_indicator);
+  ASSERT_EQ(odbcabstraction::NULL_DATA, rows[1].converted_indicator);
+  ASSERT_EQ(-9, rows[2].converted);
+  ASSERT_EQ(7, rows[0].copied);
+  ASSERT_EQ(sizeof(int32_t), rows[0].copied_indicator);
+  ASSERT_EQ(odbcabstraction::NULL_DATA, rows[1].copied_indicator);
+  ASSERT_EQ(-9, rows[2].copied);
+  ASSERT_EQ(sizeof(int32_t), rows[2].copied_indicator);
+}
+
 } // namespace flight_sql
 } // namespace driver
@@ -79,7 +79,7 @@ inline RowStatus MoveSingleCellToCharBuffer(std::vector<uint8_t> &buffer,
                binding->buffer_length);
 
   auto *byte_buffer =
-      static_cast<char *>(binding->buffer) + i * binding->buffer_length;
+      static_cast<char *>(binding->GetCellBuffer(i, binding->buffer_length));
   auto *char_buffer = (CHAR_TYPE *)byte_buffer;
   memcpy(char_buffer, ((char *)value) + value_offset, value_length);
 
@@ -106,7 +106,7 @@ inline RowStatus MoveSingleCellToCharBuffer(std::vector<uint8_t> &buffer,
   }
 
   if (binding->strlen_buffer) {
-    binding->strlen_buffer[i] = static_cast<ssize_t>(remaining_length);
+    *binding->GetCellIndicator(i) = static_cast<ssize_t>(remaining_length);
   }
 
   return result;
@@ -138,6 +138,12 @@ size_t StringArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::GetCellLength_impl(
   return binding->buffer_length;
 }
 
+template <CDataType TARGET_TYPE, typename CHAR_TYPE>
+void StringArrayFlightSqlAccessor<TARGET_TYPE, CHAR_TYPE>::OnArrayChanged_impl() {
+  // The converted value cached for last_arrow_row_ belongs to the old array.
+  last_arrow_row_ = -1;
+}
+
 template class StringArrayFlightSqlAccessor<odbcabstraction::CDataType_CHAR, char>;
 template class StringArrayFlightSqlAccessor<odbcabstraction::CDataType_WCHAR, char16_t>;
 template class StringArrayFlightSqlAccessor<odbcabstraction::CDataType_WCHAR, char32_t>;
@@ -33,6 +33,8 @@ public:
 
   size_t GetCellLength_impl(ColumnBinding *binding) const;
 
+  void OnArrayChanged_impl();
+
 private:
   std::vector<uint8_t> buffer_;
 #if defined _WIN32 || defined _WIN64
@@ -74,6 +74,39 @@ TEST(StringArrayAccessor, Test_CDataType_CHAR_Truncation) {
   ASSERT_EQ(values[0], ss.str());
 }
 
+TEST(StringArrayAccessor, Test_CDataType_CHAR_TruncationWarningsCoalesce) {
+  std::vector<std::string> values(1000, "ABCDEFGHIJ");
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>(values, &array);
+
+  StringArrayFlightSqlAccessor<CDataType_CHAR, char> accessor(array.get());
+
+  size_t max_strlen = 4;
+  std::vector<char> buffer(values.size() * max_strlen);
+  std::vector<ssize_t> strlen_buffer(values.size());
+  std::vector<uint16_t> row_status(values.size(), odbcabstraction::RowStatus_SUCCESS);
+
+  ColumnBinding binding(CDataType_CHAR, 0, 0, buffer.data(), max_strlen,
+                        strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(values.size(), accessor.GetColumnarData(&binding, 0, values.size(), value_offset,
+                                                    false, diagnostics, row_status.data()));
+
+  // Every row is flagged, but the diagnostics hold a single counted record.
+  ASSERT_EQ(odbcabstraction::RowStatus_SUCCESS_WITH_INFO, row_status.back());
+  ASSERT_EQ(1, diagnostics.GetRecordCount());
+  ASSERT_EQ("01004", diagnostics.GetSQLState(0));
+  ASSERT_NE(std::string::npos, diagnostics.GetMessageText(0).find("(1000 occurrences)"));
+
+  odbcabstraction::Diagnostics other("Foo", "Foo", OdbcVersion::V_3);
+  other.AddTruncationWarning();
+  diagnostics.TakeRecords(other);
+  ASSERT_EQ(1, diagnostics.GetRecordCount());
+  ASSERT_NE(std::string::npos, diagnostics.GetMessageText(0).find("(1001 occurrences)"));
+}
+
 TEST(StringArrayAccessor, Test_CDataType_WCHAR_Basic) {
   std::vector<std::string> values = {"foo", "barx", "baz123"};
   std::shared_ptr<Array> array;
@@ -146,5 +179,34 @@ TEST(StringArrayAccessor, Test_CDataType_WCHAR_Truncation) {
   ASSERT_EQ(expected, finalStr);
 }
 
+TEST(StringArrayAccessor, Test_CDataType_WCHAR_SetArray) {
+  std::shared_ptr<Array> first_array;
+  ArrayFromVector<StringType, std::string>({"foo"}, &first_array);
+  std::shared_ptr<Array> second_array;
+  ArrayFromVector<StringType, std::string>({"barx"}, &second_array);
+
+  auto accessor = CreateWCharStringArrayAccessor(first_array.get());
+
+  size_t max_strlen = 64;
+  std::vector<uint8_t> buffer(max_strlen);
+  std::vector<ssize_t> strlen_buffer(1);
+
+  ColumnBinding binding(CDataType_WCHAR, 0, 0, buffer.data(), max_strlen,
+                        strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(1, accessor->GetColumnarData(&binding, 0, 1, value_offset, false, diagnostics, nullptr));
+
+  // Row 0 of the next batch must not be served from the previous conversion.
+  accessor->SetArray(second_array.get());
+  ASSERT_EQ(1, accessor->GetColumnarData(&binding, 0, 1, value_offset, false, diagnostics, nullptr));
+
+  std::vector<uint8_t> expected;
+  Utf8ToWcs("barx", &expected);
+  ASSERT_EQ(expected.size(), strlen_buffer[0]);
+  ASSERT_EQ(expected, std::vector<uint8_t>(buffer.data(), buffer.data() + strlen_buffer[0]));
+}
+
 } // namespace flight_sql
 } // namespace driver
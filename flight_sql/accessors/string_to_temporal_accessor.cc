@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "string_to_temporal_accessor.h"
+
+#include "common.h"
+#include <arrow/util/endian.h>
+#include <cstring>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using namespace odbcabstraction;
+
+namespace {
+
+constexpr uint64_t ASCII_ZEROS = 0x3030303030303030ULL;
+constexpr uint64_t HIGH_NIBBLES = 0xF0F0F0F0F0F0F0F0ULL;
+constexpr uint64_t DIGIT_CARRY = 0x0606060606060606ULL;
+
+// "YYYY-MM-": digits in every byte but the dashes at bytes 4 and 7.
+constexpr uint64_t DATE_DIGIT_LANES = 0x00FFFF00FFFFFFFFULL;
+constexpr uint64_t DATE_SEPARATORS = 0x2D00002D00000000ULL;
+
+// "HH:MM:SS": digits in every byte but the colons at bytes 2 and 5.
+constexpr uint64_t TIME_DIGIT_LANES = 0xFFFF00FFFF00FFFFULL;
+constexpr uint64_t TIME_SEPARATORS = 0x00003A00003A0000ULL;
+
+constexpr int FRACTION_DIGITS = 9;
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+/// Validates eight characters at once against a pattern of ASCII digits and
+/// fixed separators. \p digit_lanes has 0xFF in every byte that must be a
+/// digit, the remaining bytes must equal those of \p separators. On success
+/// every digit byte of \p digits holds that digit's value.
+inline bool MatchPattern8(const char *text, uint64_t digit_lanes, uint64_t separators,
+                          uint64_t &digits) {
+  uint64_t word;
+  std::memcpy(&word, text, sizeof(word));
+  word = arrow::bit_util::FromLittleEndian(word);
+
+  const uint64_t zeros = ASCII_ZEROS & digit_lanes;
+  const uint64_t high_nibbles = HIGH_NIBBLES & digit_lanes;
+  const uint64_t candidates = word & digit_lanes;
+  // A digit has 3 as its high nibble, and keeps it after adding 6.
+  if ((candidates & high_nibbles) != zeros ||
+      ((candidates + (DIGIT_CARRY & digit_lanes)) & high_nibbles) != zeros ||
+      (word & ~digit_lanes) != separators) {
+    return false;
+  }
+  digits = candidates - zeros;
+  return true;
+}
+
+inline int DigitAt(uint64_t digits, int byte) {
+  return static_cast<int>((digits >> (8 * byte)) & 0xF);
+}
+
+inline bool ParseTwoDigits(const char *text, int &value) {
+  if (!IsDigit(text[0]) || !IsDigit(text[1])) {
+    return false;
+  }
+  value = (text[0] - '0') * 10 + (text[1] - '0');
+  return true;
+}
+
+std::string_view TrimSpaces(std::string_view text) {
+  const size_t first = text.find_first_not_of(' ');
+  if (first == std::string_view::npos) {
+    return {};
+  }
+  return text.substr(first, text.find_last_not_of(' ') - first + 1);
+}
+
+int DaysInMonth(int year, int month) {
+  static const int DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (month == 2 && (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0))) {
+    return 29;
+  }
+  return DAYS[month - 1];
+}
+
+struct TimeOfDay {
+  int hour = 0;
+  int minute = 0;
+  int second = 0;
+  // Nanoseconds, as in TIMESTAMP_STRUCT::fraction.
+  uint32_t fraction = 0;
+};
+
+/// Parses "YYYY-MM-DD" at the start of \p text and advances past it.
+bool ConsumeDate(std::string_view &text, int &year, int &month, int &day) {
+  uint64_t digits;
+  if (text.size() < 10 ||
+      !MatchPattern8(text.data(), DATE_DIGIT_LANES, DATE_SEPARATORS, digits) ||
+      !ParseTwoDigits(text.data() + 8, day)) {
+    return false;
+  }
+  year = DigitAt(digits, 0) * 1000 + DigitAt(digits, 1) * 100 + DigitAt(digits, 2) * 10 +
+         DigitAt(digits, 3);
+  month = DigitAt(digits, 5) * 10 + DigitAt(digits, 6);
+  if (month < 1 || month > 12 || day < 1 || day > DaysInMonth(year, month)) {
+    return false;
+  }
+  text.remove_prefix(10);
+  return true;
+}
+
+/// Parses "HH:MM", "HH:MM:SS" or "HH:MM:SS.f" with up to nine fractional
+/// digits at the start of \p text and advances past it.
+bool ConsumeTime(std::string_view &text, TimeOfDay &time) {
+  time = TimeOfDay();
+  uint64_t digits;
+  if (text.size() >= 8 && text[5] == ':') {
+    if (!MatchPattern8(text.data(), TIME_DIGIT_LANES, TIME_SEPARATORS, digits)) {
+      return false;
+    }
+    time.hour = DigitAt(digits, 0) * 10 + DigitAt(digits, 1);
+    time.minute = DigitAt(digits, 3) * 10 + DigitAt(digits, 4);
+    time.second = DigitAt(digits, 6) * 10 + DigitAt(digits, 7);
+    text.remove_prefix(8);
+
+    if (!text.empty() && text[0] == '.') {
+      text.remove_prefix(1);
+      size_t count = 0;
+      uint32_t fraction = 0;
+      for (; count < text.size() && IsDigit(text[count]); ++count) {
+        if (count == FRACTION_DIGITS) {
+          return false;
+        }
+        fraction = fraction * 10 + static_cast<uint32_t>(text[count] - '0');
+      }
+      if (count == 0) {
+        return false;
+      }
+      for (size_t i = count; i < FRACTION_DIGITS; ++i) {
+        fraction *= 10;
+      }
+      time.fraction = fraction;
+      text.remove_prefix(count);
+    }
+  } else {
+    if (text.size() < 5 || !ParseTwoDigits(text.data(), time.hour) || text[2] != ':' ||
+        !ParseTwoDigits(text.data() + 3, time.minute)) {
+      return false;
+    }
+    text.remove_prefix(5);
+  }
+  return time.hour <= 23 && time.minute <= 59 && time.second <= 59;
+}
+
+/// Parses the part of a timestamp following the date: 'T' or a space, the
+/// time of day and an optional 'Z'. Nothing may follow.
+bool ConsumeTimeSuffix(std::string_view &text, TimeOfDay &time) {
+  if (text[0] != 'T' && text[0] != ' ') {
+    return false;
+  }
+  text.remove_prefix(1);
+  if (!ConsumeTime(text, time)) {
+    return false;
+  }
+  if (!text.empty() && text[0] == 'Z') {
+    text.remove_prefix(1);
+  }
+  return text.empty();
+}
+
+} // namespace
+
+bool ParseIsoDate(std::string_view text, DATE_STRUCT &date, bool &truncated) {
+  text = TrimSpaces(text);
+  int year, month, day;
+  if (!ConsumeDate(text, year, month, day)) {
+    return false;
+  }
+  TimeOfDay time;
+  if (!text.empty() && !ConsumeTimeSuffix(text, time)) {
+    return false;
+  }
+
+  truncated = time.hour != 0 || time.minute != 0 || time.second != 0 || time.fraction != 0;
+  date.year = static_cast<SQLSMALLINT>(year);
+  date.month = static_cast<SQLUSMALLINT>(month);
+  date.day = static_cast<SQLUSMALLINT>(day);
+  return true;
+}
+
+bool ParseIsoTime(std::string_view text, TIME_STRUCT &time, bool &truncated) {
+  text = TrimSpaces(text);
+  TimeOfDay time_of_day;
+  if (!ConsumeTime(text, time_of_day) || !text.empty()) {
+    return false;
+  }
+
+  truncated = time_of_day.fraction != 0;
+  time.hour = static_cast<SQLUSMALLINT>(time_of_day.hour);
+  time.minute = static_cast<SQLUSMALLINT>(time_of_day.minute);
+  time.second = static_cast<SQLUSMALLINT>(time_of_day.second);
+  return true;
+}
+
+bool ParseIsoTimestamp(std::string_view text, TIMESTAMP_STRUCT &timestamp) {
+  text = TrimSpaces(text);
+  int year, month, day;
+  if (!ConsumeDate(text, year, month, day)) {
+    return false;
+  }
+  TimeOfDay time;
+  if (!text.empty() && !ConsumeTimeSuffix(text, time)) {
+    return false;
+  }
+
+  timestamp.year = static_cast<SQLSMALLINT>(year);
+  timestamp.month = static_cast<SQLUSMALLINT>(month);
+  timestamp.day = static_cast<SQLUSMALLINT>(day);
+  timestamp.hour = static_cast<SQLUSMALLINT>(time.hour);
+  timestamp.minute = static_cast<SQLUSMALLINT>(time.minute);
+  timestamp.second = static_cast<SQLUSMALLINT>(time.second);
+  timestamp.fraction = static_cast<SQLUINTEGER>(time.fraction);
+  return true;
+}
+
+template <CDataType TARGET_TYPE>
+StringToTemporalFlightSqlAccessor<TARGET_TYPE>::StringToTemporalFlightSqlAccessor(Array *array)
+    : FlightSqlAccessor<StringArray, TARGET_TYPE,
+                        StringToTemporalFlightSqlAccessor<TARGET_TYPE>>(array) {}
+
+template <CDataType TARGET_TYPE>
+size_t StringToTemporalFlightSqlAccessor<TARGET_TYPE>::GetColumnarData_impl(
+    ColumnBinding *binding, int64_t starting_row, int64_t cells, int64_t &value_offset,
+    bool update_value_offset, odbcabstraction::Diagnostics &diagnostics,
+    uint16_t* row_status_array) {
+  auto *array = this->GetArray();
+  const size_t cell_length = GetCellLength_impl(binding);
+
+  for (int64_t i = 0; i < cells; ++i) {
+    const int64_t current_arrow_row = starting_row + i;
+    if (array->IsNull(current_arrow_row)) {
+      if (!binding->strlen_buffer) {
+        throw NullWithoutIndicatorException();
+      }
+      *binding->GetCellIndicator(i) = NULL_DATA;
+      continue;
+    }
+
+    const std::string_view value = array->GetView(current_arrow_row);
+    void *buffer = binding->GetCellBuffer(i, cell_length);
+    bool truncated = false;
+    bool parsed;
+    if constexpr (TARGET_TYPE == CDataType_DATE) {
+      parsed = ParseIsoDate(value, *static_cast<DATE_STRUCT *>(buffer), truncated);
+    } else if constexpr (TARGET_TYPE == CDataType_TIME) {
+      parsed = ParseIsoTime(value, *static_cast<TIME_STRUCT *>(buffer), truncated);
+    } else {
+      parsed = ParseIsoTimestamp(value, *static_cast<TIMESTAMP_STRUCT *>(buffer));
+    }
+
+    if (!parsed) {
+      // Without a row status array there is no way to fail a single row.
+      if (!row_status_array) {
+        throw DriverException("Invalid character value for cast specification", "22018");
+      }
+      MarkRowStatus(row_status_array, i, RowStatus_ERROR);
+      diagnostics.AddCoalescedWarning(
+          "Error in row: invalid character value for cast specification", "01S01",
+          ODBCErrorCodes_GENERAL_WARNING);
+      continue;
+    }
+
+    if (binding->strlen_buffer) {
+      *binding->GetCellIndicator(i) = static_cast<ssize_t>(cell_length);
+    }
+    if (truncated) {
+      diagnostics.AddCoalescedWarning("Fractional truncation", "01S07",
+                                      ODBCErrorCodes_FRACTIONAL_TRUNCATION_WARNING);
+      MarkRowStatus(row_status_array, i, RowStatus_SUCCESS_WITH_INFO);
+    }
+  }
+
+  return static_cast<size_t>(cells);
+}
+
+template <CDataType TARGET_TYPE>
+size_t StringToTemporalFlightSqlAccessor<TARGET_TYPE>::GetCellLength_impl(
+    ColumnBinding *binding) const {
+  if constexpr (TARGET_TYPE == CDataType_DATE) {
+    return sizeof(DATE_STRUCT);
+  } else if constexpr (TARGET_TYPE == CDataType_TIME) {
+    return sizeof(TIME_STRUCT);
+  } else {
+    return sizeof(TIMESTAMP_STRUCT);
+  }
+}
+
+template class StringToTemporalFlightSqlAccessor<odbcabstraction::CDataType_DATE>;
+template class StringToTemporalFlightSqlAccessor<odbcabstraction::CDataType_TIME>;
+template class StringToTemporalFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP>;
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include "types.h"
+#include <arrow/array.h>
+#include <odbcabstraction/types.h>
+#include <string_view>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using namespace odbcabstraction;
+
+/// \brief Parses an ISO-8601 date, "YYYY-MM-DD". A trailing time of day is
+/// accepted and dropped, setting \p truncated when it is not midnight.
+/// Leading and trailing spaces are ignored.
+/// \return false when the text is not a valid date.
+bool ParseIsoDate(std::string_view text, DATE_STRUCT &date, bool &truncated);
+
+/// \brief Parses an ISO-8601 time of day, "HH:MM", "HH:MM:SS" or
+/// "HH:MM:SS.fffffffff". A non-zero fraction is dropped, setting \p truncated.
+/// \return false when the text is not a valid time.
+bool ParseIsoTime(std::string_view text, TIME_STRUCT &time, bool &truncated);
+
+/// \brief Parses an ISO-8601 timestamp, a date optionally followed by 'T' or
+/// a space and a time of day with up to nine fractional digits, and an
+/// optional 'Z' suffix.
+/// \return false when the text is not a valid timestamp.
+bool ParseIsoTimestamp(std::string_view text, TIMESTAMP_STRUCT &timestamp);
+
+/// \brief Accessor parsing temporal values that the server returns as text
+/// straight into DATE_STRUCT, TIME_STRUCT or TIMESTAMP_STRUCT buffers,
+/// without converting the array through compute kernels first. Values that
+/// do not parse fail only the rows holding them.
+template <CDataType TARGET_TYPE>
+class StringToTemporalFlightSqlAccessor
+    : public FlightSqlAccessor<StringArray, TARGET_TYPE,
+                               StringToTemporalFlightSqlAccessor<TARGET_TYPE>> {
+public:
+  explicit StringToTemporalFlightSqlAccessor(Array *array);
+
+  size_t GetColumnarData_impl(ColumnBinding *binding, int64_t starting_row, int64_t cells,
+                              int64_t &value_offset, bool update_value_offset,
+                              odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array);
+
+  size_t GetCellLength_impl(ColumnBinding *binding) const;
+};
+
+} // namespace flight_sql
+} // namespace driver
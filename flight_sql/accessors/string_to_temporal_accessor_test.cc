@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "arrow/testing/builder.h"
+#include "string_to_temporal_accessor.h"
+#include "gtest/gtest.h"
+#include <odbcabstraction/diagnostics.h>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using namespace odbcabstraction;
+
+TEST(StringToTemporalFlightSqlAccessor, ParseIsoTimestamp) {
+  TIMESTAMP_STRUCT timestamp{};
+  ASSERT_TRUE(ParseIsoTimestamp("2024-02-29 13:45:07.123456", timestamp));
+  ASSERT_EQ(2024, timestamp.year);
+  ASSERT_EQ(2, timestamp.month);
+  ASSERT_EQ(29, timestamp.day);
+  ASSERT_EQ(13, timestamp.hour);
+  ASSERT_EQ(45, timestamp.minute);
+  ASSERT_EQ(7, timestamp.second);
+  ASSERT_EQ(123456000, timestamp.fraction);
+
+  ASSERT_TRUE(ParseIsoTimestamp("2024-12-31T23:59:59Z", timestamp));
+  ASSERT_EQ(0, timestamp.fraction);
+  ASSERT_TRUE(ParseIsoTimestamp(" 2024-01-02 ", timestamp));
+  ASSERT_EQ(0, timestamp.hour);
+
+  ASSERT_FALSE(ParseIsoTimestamp("2023-02-29", timestamp));
+  ASSERT_FALSE(ParseIsoTimestamp("2024-1-02", timestamp));
+  ASSERT_FALSE(ParseIsoTimestamp("2024/01/02", timestamp));
+  ASSERT_FALSE(ParseIsoTimestamp("2024-01-02 24:00:00", timestamp));
+  ASSERT_FALSE(ParseIsoTimestamp("2024-01-02 10:00:00.", timestamp));
+  ASSERT_FALSE(ParseIsoTimestamp("2024-01-02 10:00:00.1234567891", timestamp));
+}
+
+TEST(StringToTemporalFlightSqlAccessor, ParseIsoDateAndTime) {
+  DATE_STRUCT date{};
+  bool truncated = true;
+  ASSERT_TRUE(ParseIsoDate("2024-03-04", date, truncated));
+  ASSERT_FALSE(truncated);
+  ASSERT_EQ(2024, date.year);
+  ASSERT_EQ(3, date.month);
+  ASSERT_EQ(4, date.day);
+  ASSERT_TRUE(ParseIsoDate("2024-03-04 01:00:00", date, truncated));
+  ASSERT_TRUE(truncated);
+
+  TIME_STRUCT time{};
+  ASSERT_TRUE(ParseIsoTime("12:30", time, truncated));
+  ASSERT_FALSE(truncated);
+  ASSERT_EQ(12, time.hour);
+  ASSERT_EQ(30, time.minute);
+  ASSERT_EQ(0, time.second);
+  ASSERT_TRUE(ParseIsoTime("12:30:15.5", time, truncated));
+  ASSERT_TRUE(truncated);
+  ASSERT_EQ(15, time.second);
+  ASSERT_FALSE(ParseIsoTime("25:00", time, truncated));
+  ASSERT_FALSE(ParseIsoTime("12:3a", time, truncated));
+}
+
+TEST(StringToTemporalFlightSqlAccessor, Test_CDataType_TIMESTAMP) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>({true, false, true},
+                                           {"2022-04-12 19:53:58.11", "", "1970-01-02"},
+                                           &array);
+
+  StringToTemporalFlightSqlAccessor<CDataType_TIMESTAMP> accessor(array.get());
+
+  std::vector<TIMESTAMP_STRUCT> buffer(3);
+  std::vector<ssize_t> strlen_buffer(3);
+  ColumnBinding binding(CDataType_TIMESTAMP, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(3, accessor.GetColumnarData(&binding, 0, 3, value_offset, false, diagnostics, nullptr));
+
+  ASSERT_EQ(sizeof(TIMESTAMP_STRUCT), strlen_buffer[0]);
+  ASSERT_EQ(2022, buffer[0].year);
+  ASSERT_EQ(58, buffer[0].second);
+  ASSERT_EQ(110000000, buffer[0].fraction);
+  ASSERT_EQ(odbcabstraction::NULL_DATA, strlen_buffer[1]);
+  ASSERT_EQ(sizeof(TIMESTAMP_STRUCT), strlen_buffer[2]);
+  ASSERT_EQ(2, buffer[2].day);
+}
+
+TEST(StringToTemporalFlightSqlAccessor, Test_InvalidValueFailsRow) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>({"2024-01-02", "not a date", "2024-01-03 10:00"},
+                                           &array);
+
+  StringToTemporalFlightSqlAccessor<CDataType_DATE> accessor(array.get());
+
+  std::vector<DATE_STRUCT> buffer(3);
+  std::vector<ssize_t> strlen_buffer(3);
+  std::vector<uint16_t> row_status(3, odbcabstraction::RowStatus_SUCCESS);
+  ColumnBinding binding(CDataType_DATE, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(3, accessor.GetColumnarData(&binding, 0, 3, value_offset, false, diagnostics,
+                                        row_status.data()));
+
+  ASSERT_EQ(odbcabstraction::RowStatus_SUCCESS, row_status[0]);
+  ASSERT_EQ(2, buffer[0].day);
+  ASSERT_EQ(odbcabstraction::RowStatus_ERROR, row_status[1]);
+  ASSERT_EQ(odbcabstraction::RowStatus_SUCCESS_WITH_INFO, row_status[2]);
+  ASSERT_EQ(3, buffer[2].day);
+  ASSERT_EQ("01S01", diagnostics.GetSQLState(0));
+  ASSERT_EQ("01S07", diagnostics.GetSQLState(1));
+
+  // Without a row status array the whole fetch fails.
+  ASSERT_THROW(accessor.GetColumnarData(&binding, 0, 3, value_offset, false, diagnostics, nullptr),
+               DriverException);
+}
+
+} // namespace flight_sql
+} // namespace driver
@@ -11,7 +11,9 @@
 namespace driver {
 namespace flight_sql {
 
-Accessor* CreateTimeAccessor(arrow::Array *array, arrow::Type::type type) {
+namespace {
+template <CDataType TARGET_TYPE>
+Accessor* CreateTimeAccessorForTarget(arrow::Array *array, arrow::Type::type type) {
   auto time_type =
       arrow::internal::checked_pointer_cast<TimeType>(array->type());
   auto time_unit = time_type->unit();
@@ -19,37 +21,46 @@ Accessor* CreateTimeAccessor(arrow::Array *array, arrow::Type::type type) {
   if (type == arrow::Type::TIME32) {
     switch (time_unit) {
     case TimeUnit::SECOND:
-      return new TimeArrayFlightSqlAccessor<CDataType_TIME, Time32Array,
+      return new TimeArrayFlightSqlAccessor<TARGET_TYPE, Time32Array,
                                             TimeUnit::SECOND>(array);
     case TimeUnit::MILLI:
-      return new TimeArrayFlightSqlAccessor<CDataType_TIME, Time32Array,
+      return new TimeArrayFlightSqlAccessor<TARGET_TYPE, Time32Array,
                                             TimeUnit::MILLI>(array);
     case TimeUnit::MICRO:
-      return new TimeArrayFlightSqlAccessor<CDataType_TIME, Time32Array,
+      return new TimeArrayFlightSqlAccessor<TARGET_TYPE, Time32Array,
                                             TimeUnit::MICRO>(array);
     case TimeUnit::NANO:
-      return new TimeArrayFlightSqlAccessor<CDataType_TIME, Time32Array,
+      return new TimeArrayFlightSqlAccessor<TARGET_TYPE, Time32Array,
                                             TimeUnit::NANO>(array);
     }
   } else if (type == arrow::Type::TIME64) {
     switch (time_unit) {
     case TimeUnit::SECOND:
-      return new TimeArrayFlightSqlAccessor<CDataType_TIME, Time64Array,
+      return new TimeArrayFlightSqlAccessor<TARGET_TYPE, Time64Array,
                                             TimeUnit::SECOND>(array);
     case TimeUnit::MILLI:
-      return new TimeArrayFlightSqlAccessor<CDataType_TIME, Time64Array,
+      return new TimeArrayFlightSqlAccessor<TARGET_TYPE, Time64Array,
                                             TimeUnit::MILLI>(array);
     case TimeUnit::MICRO:
-      return new TimeArrayFlightSqlAccessor<CDataType_TIME, Time64Array,
+      return new TimeArrayFlightSqlAccessor<TARGET_TYPE, Time64Array,
                                             TimeUnit::MICRO>(array);
     case TimeUnit::NANO:
-      return new TimeArrayFlightSqlAccessor<CDataType_TIME, Time64Array,
+      return new TimeArrayFlightSqlAccessor<TARGET_TYPE, Time64Array,
                                             TimeUnit::NANO>(array);
     }
   }
   assert(false);
   throw DriverException("Unsupported input supplied to CreateTimeAccessor");
 }
+} // namespace
+
+Accessor* CreateTimeAccessor(arrow::Array *array, arrow::Type::type type,
+                             CDataType target_type) {
+  if (target_type == CDataType_TIMESTAMP) {
+    return CreateTimeAccessorForTarget<CDataType_TIMESTAMP>(array, type);
+  }
+  return CreateTimeAccessorForTarget<CDataType_TIME>(array, type);
+}
 
 namespace {
 template <typename T>
@@ -67,6 +78,24 @@ int64_t ConvertTimeValue<Time64Array>(int64_t value, TimeUnit::type unit) {
   return unit == TimeUnit::MICRO ? value / MICRO_TO_SECONDS_DIVISOR
                                  : value / NANO_TO_SECONDS_DIVISOR;
 }
+
+constexpr int64_t GetUnitsPerSecond(TimeUnit::type unit) {
+  return unit == TimeUnit::SECOND  ? 1
+         : unit == TimeUnit::MILLI ? MILLI_TO_SECONDS_DIVISOR
+         : unit == TimeUnit::MICRO ? MICRO_TO_SECONDS_DIVISOR
+                                   : NANO_TO_SECONDS_DIVISOR;
+}
+
+DATE_STRUCT GetToday() {
+  tm date{};
+  GetTimeForSecondsSinceEpoch(date, GetTodayTimeFromEpoch());
+
+  DATE_STRUCT today{};
+  today.year = static_cast<SQLSMALLINT>(1900 + date.tm_year);
+  today.month = static_cast<SQLUSMALLINT>(date.tm_mon + 1);
+  today.day = static_cast<SQLUSMALLINT>(date.tm_mday);
+  return today;
+}
 } // namespace
 
 template <CDataType TARGET_TYPE, typename ARROW_ARRAY, TimeUnit::type UNIT>
@@ -74,13 +103,41 @@ TimeArrayFlightSqlAccessor<
     TARGET_TYPE, ARROW_ARRAY, UNIT>::TimeArrayFlightSqlAccessor(Array *array)
     : FlightSqlAccessor<ARROW_ARRAY, TARGET_TYPE,
                         TimeArrayFlightSqlAccessor<TARGET_TYPE, ARROW_ARRAY, UNIT>>(
-          array) {}
+          array) {
+  if constexpr (TARGET_TYPE == CDataType_TIMESTAMP) {
+    today_ = GetToday();
+  }
+}
 
 template <CDataType TARGET_TYPE, typename ARROW_ARRAY, TimeUnit::type UNIT>
 RowStatus TimeArrayFlightSqlAccessor<TARGET_TYPE, ARROW_ARRAY, UNIT>::MoveSingleCell_impl(
   ColumnBinding *binding, int64_t arrow_row, int64_t cell_counter, int64_t &value_offset,
     bool update_value_offset, odbcabstraction::Diagnostics &diagnostic) {
-  auto *buffer = static_cast<TIME_STRUCT *>(binding->buffer);
+  if constexpr (TARGET_TYPE == CDataType_TIMESTAMP) {
+    // Split the time of day directly instead of building a timestamp array
+    // through several compute passes.
+    constexpr int64_t units_per_second = GetUnitsPerSecond(UNIT);
+    const int64_t value = this->GetArray()->Value(arrow_row);
+    const int64_t seconds = value / units_per_second;
+
+    auto *buffer = static_cast<TIMESTAMP_STRUCT *>(
+        binding->GetCellBuffer(cell_counter, sizeof(TIMESTAMP_STRUCT)));
+    buffer->year = today_.year;
+    buffer->month = today_.month;
+    buffer->day = today_.day;
+    buffer->hour = static_cast<SQLUSMALLINT>(seconds / 3600);
+    buffer->minute = static_cast<SQLUSMALLINT>(seconds / 60 % 60);
+    buffer->second = static_cast<SQLUSMALLINT>(seconds % 60);
+    buffer->fraction = static_cast<SQLUINTEGER>(
+        value % units_per_second * (NANO_TO_SECONDS_DIVISOR / units_per_second));
+
+    if (binding->strlen_buffer) {
+      *binding->GetCellIndicator(cell_counter) = static_cast<ssize_t>(GetCellLength_impl(binding));
+    }
+    return odbcabstraction::RowStatus_SUCCESS;
+  }
+
+  auto *buffer = static_cast<TIME_STRUCT *>(binding->GetCellBuffer(cell_counter, sizeof(TIME_STRUCT)));
 
   tm time{};
 
@@ -89,18 +146,21 @@ RowStatus TimeArrayFlightSqlAccessor<TARGET_TYPE, ARROW_ARRAY, UNIT>::MoveSingle
 
   GetTimeForSecondsSinceEpoch(time, converted_value_seconds);
 
-  buffer[cell_counter].hour = time.tm_hour;
-  buffer[cell_counter].minute = time.tm_min;
-  buffer[cell_counter].second = time.tm_sec;
+  buffer->hour = time.tm_hour;
+  buffer->minute = time.tm_min;
+  buffer->second = time.tm_sec;
 
   if (binding->strlen_buffer) {
-    binding->strlen_buffer[cell_counter] = static_cast<ssize_t>(GetCellLength_impl(binding));
+    *binding->GetCellIndicator(cell_counter) = static_cast<ssize_t>(GetCellLength_impl(binding));
   }
   return odbcabstraction::RowStatus_SUCCESS;
 }
 
 template <CDataType TARGET_TYPE, typename ARROW_ARRAY, TimeUnit::type UNIT>
 size_t TimeArrayFlightSqlAccessor<TARGET_TYPE, ARROW_ARRAY, UNIT>::GetCellLength_impl(ColumnBinding *binding) const {
+  if constexpr (TARGET_TYPE == CDataType_TIMESTAMP) {
+    return sizeof(TIMESTAMP_STRUCT);
+  }
   return sizeof(TIME_STRUCT);
 }
 
@@ -120,6 +180,22 @@ template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIME,
                                           Time64Array, TimeUnit::MICRO>;
 template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIME,
                                           Time64Array, TimeUnit::NANO>;
+template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP,
+                                          Time32Array, TimeUnit::SECOND>;
+template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP,
+                                          Time32Array, TimeUnit::MILLI>;
+template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP,
+                                          Time32Array, TimeUnit::MICRO>;
+template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP,
+                                          Time32Array, TimeUnit::NANO>;
+template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP,
+                                          Time64Array, TimeUnit::SECOND>;
+template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP,
+                                          Time64Array, TimeUnit::MILLI>;
+template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP,
+                                          Time64Array, TimeUnit::MICRO>;
+template class TimeArrayFlightSqlAccessor<odbcabstraction::CDataType_TIMESTAMP,
+                                          Time64Array, TimeUnit::NANO>;
 
 } // namespace flight_sql
 } // namespace driver
@@ -17,7 +17,10 @@ namespace flight_sql {
 using namespace arrow;
 using namespace odbcabstraction;
 
-Accessor* CreateTimeAccessor(arrow::Array *array, arrow::Type::type type);
+/// \brief Creates an accessor for a TIME32 or TIME64 array, writing either
+/// TIME_STRUCT or, for CDataType_TIMESTAMP, TIMESTAMP_STRUCT values dated today.
+Accessor* CreateTimeAccessor(arrow::Array *array, arrow::Type::type type,
+                             CDataType target_type = CDataType_TIME);
 
 template <CDataType TARGET_TYPE, typename ARROW_ARRAY, arrow::TimeUnit::type UNIT>
 class TimeArrayFlightSqlAccessor
@@ -33,6 +36,11 @@ public:
                            odbcabstraction::Diagnostics &diagnostic);
 
   size_t GetCellLength_impl(ColumnBinding *binding) const;
+
+private:
+  // The date given to TIMESTAMP_STRUCT targets. Taken once when the accessor
+  // is created, so it holds for every batch of the result set.
+  DATE_STRUCT today_{};
 };
 } // namespace flight_sql
 } // namespace driver
@@ -156,5 +156,76 @@ TEST(TEST_TIME64, TIME_WITH_NANO) {
     ASSERT_EQ(buffer[i].second, time.tm_sec);
   }
 }
+
+TEST(TEST_TIME32, TIMESTAMP_WITH_MILLI) {
+  auto value_field = field("f0", time32(TimeUnit::MILLI));
+
+  std::vector<int32_t> t32_values = {14896123, 0, 86399999};
+
+  std::shared_ptr<Array> time32_array;
+  ArrayFromVector<Time32Type, int32_t>(value_field->type(),
+                                       t32_values, &time32_array);
+
+  TimeArrayFlightSqlAccessor<CDataType_TIMESTAMP, Time32Array, TimeUnit::MILLI> accessor(time32_array.get());
+
+  std::vector<TIMESTAMP_STRUCT> buffer(t32_values.size());
+  std::vector<ssize_t> strlen_buffer(t32_values.size());
+
+  ColumnBinding binding(CDataType_TIMESTAMP, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(t32_values.size(),
+          accessor.GetColumnarData(&binding, 0, t32_values.size(), value_offset, false, diagnostics, nullptr));
+
+  tm today{};
+  GetTimeForSecondsSinceEpoch(today, GetTodayTimeFromEpoch());
+
+  for (size_t i = 0; i < t32_values.size(); ++i) {
+    ASSERT_EQ(sizeof(TIMESTAMP_STRUCT), strlen_buffer[i]);
+
+    tm time{};
+    GetTimeForSecondsSinceEpoch(time, t32_values[i] / 1000);
+    ASSERT_EQ(today.tm_year + 1900, buffer[i].year);
+    ASSERT_EQ(today.tm_mon + 1, buffer[i].month);
+    ASSERT_EQ(today.tm_mday, buffer[i].day);
+    ASSERT_EQ(time.tm_hour, buffer[i].hour);
+    ASSERT_EQ(time.tm_min, buffer[i].minute);
+    ASSERT_EQ(time.tm_sec, buffer[i].second);
+    ASSERT_EQ(t32_values[i] % 1000 * 1000000, buffer[i].fraction);
+  }
+}
+
+TEST(TEST_TIME64, TIMESTAMP_WITH_MICRO) {
+  auto value_field = field("f0", time64(TimeUnit::MICRO));
+
+  std::vector<int64_t> t64_values = {86399999999LL, 3723000001LL};
+
+  std::shared_ptr<Array> time64_array;
+  ArrayFromVector<Time64Type, int64_t>(value_field->type(),
+                                       t64_values, &time64_array);
+
+  TimeArrayFlightSqlAccessor<CDataType_TIMESTAMP, Time64Array, TimeUnit::MICRO> accessor(time64_array.get());
+
+  std::vector<TIMESTAMP_STRUCT> buffer(t64_values.size());
+  std::vector<ssize_t> strlen_buffer(t64_values.size());
+
+  ColumnBinding binding(CDataType_TIMESTAMP, 0, 0, buffer.data(), 0, strlen_buffer.data());
+
+  int64_t value_offset = 0;
+  odbcabstraction::Diagnostics diagnostics("Foo", "Foo", OdbcVersion::V_3);
+  ASSERT_EQ(t64_values.size(),
+          accessor.GetColumnarData(&binding, 0, t64_values.size(), value_offset, false, diagnostics, nullptr));
+
+  ASSERT_EQ(23, buffer[0].hour);
+  ASSERT_EQ(59, buffer[0].minute);
+  ASSERT_EQ(59, buffer[0].second);
+  ASSERT_EQ(999999000, buffer[0].fraction);
+  ASSERT_EQ(1, buffer[1].hour);
+  ASSERT_EQ(2, buffer[1].minute);
+  ASSERT_EQ(3, buffer[1].second);
+  ASSERT_EQ(1000, buffer[1].fraction);
+}
+
 } // namespace flight_sql
 } // namespace driver
@@ -78,7 +78,7 @@ TimestampArrayFlightSqlAccessor<TARGET_TYPE, UNIT>::MoveSingleCell_impl(
   // for each time unit will not convert correctly.  This is mostly interesting for
   // nanoseconds as timestamps in other units are outside of the accepted range of
   // Gregorian dates.
-  auto *buffer = static_cast<TIMESTAMP_STRUCT *>(binding->buffer);
+  auto *buffer = static_cast<TIMESTAMP_STRUCT *>(binding->GetCellBuffer(cell_counter, sizeof(TIMESTAMP_STRUCT)));
 
   int64_t value = this->GetArray()->Value(arrow_row);
   const auto divisor = GetConversionToSecondsDivisor(UNIT);
@@ -96,16 +96,16 @@ TimestampArrayFlightSqlAccessor<TARGET_TYPE, UNIT>::MoveSingleCell_impl(
 
   GetTimeForSecondsSinceEpoch(timestamp, converted_result_seconds);
 
-  buffer[cell_counter].year = 1900 + (timestamp.tm_year);
-  buffer[cell_counter].month = timestamp.tm_mon + 1;
-  buffer[cell_counter].day = timestamp.tm_mday;
-  buffer[cell_counter].hour = timestamp.tm_hour;
-  buffer[cell_counter].minute = timestamp.tm_min;
-  buffer[cell_counter].second = timestamp.tm_sec;
-  buffer[cell_counter].fraction = CalculateFraction(UNIT, value);
+  buffer->year = 1900 + (timestamp.tm_year);
+  buffer->month = timestamp.tm_mon + 1;
+  buffer->day = timestamp.tm_mday;
+  buffer->hour = timestamp.tm_hour;
+  buffer->minute = timestamp.tm_min;
+  buffer->second = timestamp.tm_sec;
+  buffer->fraction = CalculateFraction(UNIT, value);
 
   if (binding->strlen_buffer) {
-    binding->strlen_buffer[cell_counter] = static_cast<ssize_t>(GetCellLength_impl(binding));
+    *binding->GetCellIndicator(cell_counter) = static_cast<ssize_t>(GetCellLength_impl(binding));
   }
 
   return odbcabstraction::RowStatus_SUCCESS;
@@ -32,6 +32,10 @@ struct ColumnBinding {
   CDataType target_type;
   int precision;
   int scale;
+  // Bytes between consecutive rows when the application uses row-wise binding
+  // (SQL_ATTR_ROW_BIND_TYPE). Zero means column-wise binding, where values are
+  // one cell length apart and indicators one ssize_t apart.
+  size_t row_stride = 0;
 
   ColumnBinding() = default;
 
@@ -40,6 +44,20 @@ struct ColumnBinding {
       : target_type(target_type), precision(precision), scale(scale),
         buffer(buffer), buffer_length(buffer_length),
         strlen_buffer(strlen_buffer) {}
+
+  /// \brief Address of the value of the i-th cell written in this call.
+  inline void *GetCellBuffer(int64_t i, size_t cell_length) const {
+    return static_cast<uint8_t *>(buffer) + i * (row_stride ? row_stride : cell_length);
+  }
+
+  /// \brief Address of the length/indicator of the i-th cell written in this call.
+  inline ssize_t *GetCellIndicator(int64_t i) const {
+    if (!row_stride) {
+      return strlen_buffer + i;
+    }
+    return reinterpret_cast<ssize_t *>(reinterpret_cast<uint8_t *>(strlen_buffer) +
+                                       i * row_stride);
+  }
 };
 
 /// \brief Accessor interface meant to provide a way of populating data of a
@@ -58,6 +76,10 @@ public:
                                  odbcabstraction::Diagnostics &diagnostics, uint16_t* row_status_array) = 0;
 
   virtual size_t GetCellLength(ColumnBinding *binding) const = 0;
+
+  /// \brief Points the accessor at another array of the same type, such as
+  /// the same column in the next record batch, without reconstructing it.
+  virtual void SetArray(Array *array) = 0;
 };
 
 template <typename ARROW_ARRAY, CDataType TARGET_TYPE, typename DERIVED>
@@ -79,6 +101,11 @@ public:
     return static_cast<const DERIVED *>(this)->GetCellLength_impl(binding);
   }
 
+  void SetArray(Array *array) override {
+    array_ = arrow::internal::checked_cast<ARROW_ARRAY *>(array);
+    static_cast<DERIVED *>(this)->OnArrayChanged_impl();
+  }
+
 protected:
   size_t GetColumnarData_impl(ColumnBinding *binding, int64_t starting_row, int64_t cells,
                               int64_t &value_offset, bool update_value_offset,
@@ -87,7 +114,7 @@ protected:
       int64_t current_arrow_row = starting_row + i;
       if (array_->IsNull(current_arrow_row)) {
         if (binding->strlen_buffer) {
-          binding->strlen_buffer[i] = odbcabstraction::NULL_DATA;
+          *binding->GetCellIndicator(i) = odbcabstraction::NULL_DATA;
         } else {
           throw odbcabstraction::NullWithoutIndicatorException();
         }
@@ -97,7 +124,8 @@ protected:
         auto row_status = MoveSingleCell(
             binding, current_arrow_row, i, value_offset, update_value_offset,
             diagnostics);
-        if (row_status_array) {
+        // Never replace an error already reported by another column of the row.
+        if (row_status_array && row_status_array[i] != odbcabstraction::RowStatus_ERROR) {
           row_status_array[i] = row_status;
         }
       }
@@ -110,6 +138,10 @@ protected:
     return array_;
   }
 
+  /// \brief Invoked after SetArray(). Accessors caching state derived from the
+  /// previous array must reset it here.
+  void OnArrayChanged_impl() {}
+
 private:
   ARROW_ARRAY *array_;
 
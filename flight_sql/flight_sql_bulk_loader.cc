@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_bulk_loader.h"
+
+#include "utils.h"
+#include <arrow/table.h>
+#include <odbcabstraction/exceptions.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace driver {
+namespace flight_sql {
+
+using odbcabstraction::DriverException;
+
+/// Hands the queued batches to the ingestion call, ending the stream once the
+/// loader is finished.
+class FlightSqlBulkLoader::QueueReader : public arrow::RecordBatchReader {
+public:
+  explicit QueueReader(FlightSqlBulkLoader &loader) : loader_(loader) {}
+
+  std::shared_ptr<arrow::Schema> schema() const override { return loader_.schema_; }
+
+  arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override {
+    bool aborted;
+    if (!loader_.Pop(batch, &aborted) && aborted) {
+      return arrow::Status::Cancelled("Bulk load abandoned");
+    }
+    return arrow::Status::OK();
+  }
+
+private:
+  FlightSqlBulkLoader &loader_;
+};
+
+FlightSqlBulkLoader::FlightSqlBulkLoader(std::shared_ptr<arrow::Schema> schema,
+                                         IngestFunction ingest, size_t batch_rows,
+                                         size_t buffer_capacity)
+    : schema_(std::move(schema)), batch_rows_(std::max<size_t>(batch_rows, 1)),
+      buffer_capacity_(std::max<size_t>(buffer_capacity, 1)) {
+  upload_ = std::thread([this, ingest = std::move(ingest)] {
+    auto result = ingest(std::make_shared<QueueReader>(*this), stop_source_.token());
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    result_ = std::move(result);
+    stopped_ = true;
+    not_full_.notify_all();
+  });
+}
+
+FlightSqlBulkLoader::~FlightSqlBulkLoader() {
+  if (upload_.joinable()) {
+    Abort();
+  }
+}
+
+void FlightSqlBulkLoader::Append(const std::shared_ptr<arrow::RecordBatch> &batch) {
+  int64_t offset = 0;
+  while (offset < batch->num_rows()) {
+    const int64_t rows = std::min(batch->num_rows() - offset,
+                                  static_cast<int64_t>(batch_rows_) - pending_rows_);
+    pending_.push_back(offset == 0 && rows == batch->num_rows() ? batch
+                                                                : batch->Slice(offset, rows));
+    pending_rows_ += rows;
+    offset += rows;
+
+    if (pending_rows_ == static_cast<int64_t>(batch_rows_)) {
+      Flush();
+    }
+  }
+}
+
+int64_t FlightSqlBulkLoader::Finish() {
+  if (!upload_.joinable()) {
+    throw DriverException("Function sequence error", "HY010");
+  }
+
+  Flush();
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+  }
+  upload_.join();
+
+  ThrowIfNotOK(result_.status());
+  if (!queue_.empty()) {
+    throw DriverException("The server ended the bulk load before receiving every row", "HY000");
+  }
+  return *result_;
+}
+
+void FlightSqlBulkLoader::Flush() {
+  if (pending_.empty()) {
+    return;
+  }
+
+  std::shared_ptr<arrow::RecordBatch> batch;
+  if (pending_.size() == 1) {
+    batch = std::move(pending_.front());
+  } else {
+    auto table = arrow::Table::FromRecordBatches(schema_, pending_);
+    ThrowIfNotOK(table.status());
+    auto combined = (*table)->CombineChunksToBatch();
+    ThrowIfNotOK(combined.status());
+    batch = std::move(*combined);
+  }
+  pending_.clear();
+  pending_rows_ = 0;
+
+  Push(std::move(batch));
+}
+
+void FlightSqlBulkLoader::Push(std::shared_ptr<arrow::RecordBatch> batch) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  not_full_.wait(lock, [this] { return stopped_ || queue_.size() < buffer_capacity_; });
+  if (stopped_) {
+    lock.unlock();
+    ThrowUploadError();
+  }
+
+  queue_.push_back(std::move(batch));
+  not_empty_.notify_one();
+}
+
+bool FlightSqlBulkLoader::Pop(std::shared_ptr<arrow::RecordBatch> *batch, bool *aborted) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  not_empty_.wait(lock, [this] { return aborted_ || closed_ || !queue_.empty(); });
+
+  *aborted = aborted_;
+  if (aborted_ || queue_.empty()) {
+    *batch = nullptr;
+    return false;
+  }
+
+  *batch = std::move(queue_.front());
+  queue_.pop_front();
+  not_full_.notify_one();
+  return true;
+}
+
+void FlightSqlBulkLoader::Abort() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    aborted_ = true;
+    queue_.clear();
+    not_empty_.notify_all();
+  }
+  stop_source_.RequestStop();
+  upload_.join();
+}
+
+void FlightSqlBulkLoader::ThrowUploadError() {
+  // The upload only returns early when the server rejects the load.
+  upload_.join();
+  ThrowIfNotOK(result_.status());
+  throw DriverException("The server ended the bulk load before receiving every row", "HY000");
+}
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include <arrow/record_batch.h>
+#include <arrow/result.h>
+#include <arrow/util/cancel.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace driver {
+namespace flight_sql {
+
+/// \brief Streams rows to the server through a single bulk ingestion call
+/// (Flight SQL CommandStatementIngest).
+///
+/// Appended rows are regrouped into batches of `batch_rows` rows and handed
+/// to a background upload through a queue holding at most `buffer_capacity`
+/// batches, so the caller only blocks when the network falls behind.
+class FlightSqlBulkLoader {
+public:
+  /// Runs the ingestion, reading every batch from the given reader. The stop
+  /// token is triggered when the load is abandoned.
+  typedef std::function<arrow::Result<int64_t>(
+      const std::shared_ptr<arrow::RecordBatchReader> &, const arrow::StopToken &)>
+      IngestFunction;
+
+  FlightSqlBulkLoader(std::shared_ptr<arrow::Schema> schema, IngestFunction ingest,
+                      size_t batch_rows, size_t buffer_capacity);
+
+  /// Abandons the load if it was not finished, so no partial data is committed.
+  ~FlightSqlBulkLoader();
+
+  const std::shared_ptr<arrow::Schema> &schema() const { return schema_; }
+
+  /// \brief Queues the rows of \p batch, blocking while the queue is full.
+  /// Throws the upload error if the server already rejected the load.
+  void Append(const std::shared_ptr<arrow::RecordBatch> &batch);
+
+  /// \brief Sends the remaining rows and waits for the server to store them.
+  /// \return The number of rows ingested, as reported by the server.
+  int64_t Finish();
+
+private:
+  class QueueReader;
+
+  void Flush();
+  void Push(std::shared_ptr<arrow::RecordBatch> batch);
+  bool Pop(std::shared_ptr<arrow::RecordBatch> *batch, bool *aborted);
+  void Abort();
+  void ThrowUploadError();
+
+  std::shared_ptr<arrow::Schema> schema_;
+  const size_t batch_rows_;
+  const size_t buffer_capacity_;
+
+  // Rows not filling a whole batch yet.
+  std::vector<std::shared_ptr<arrow::RecordBatch>> pending_;
+  int64_t pending_rows_ = 0;
+
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::deque<std::shared_ptr<arrow::RecordBatch>> queue_;
+  bool closed_ = false;   // No more batches will be queued.
+  bool aborted_ = false;  // The load was abandoned.
+  bool stopped_ = false;  // The upload returned.
+
+  arrow::StopSource stop_source_;
+  arrow::Result<int64_t> result_;
+  std::thread upload_;
+};
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_bulk_loader.h"
+#include "gtest/gtest.h"
+#include <arrow/array.h>
+#include <arrow/builder.h>
+#include <odbcabstraction/exceptions.h>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using odbcabstraction::DriverException;
+
+namespace {
+
+std::shared_ptr<Schema> IdSchema() { return schema({field("id", int32())}); }
+
+std::shared_ptr<RecordBatch> MakeIds(int32_t first, int32_t count) {
+  Int32Builder builder;
+  for (int32_t i = 0; i < count; ++i) {
+    EXPECT_TRUE(builder.Append(first + i).ok());
+  }
+  std::shared_ptr<Array> array;
+  EXPECT_TRUE(builder.Finish(&array).ok());
+  return RecordBatch::Make(IdSchema(), count, {array});
+}
+
+} // namespace
+
+TEST(BulkLoader, RegroupsRowsIntoBatches) {
+  std::vector<int64_t> batch_sizes;
+  std::vector<int32_t> ids;
+  auto ingest = [&](const std::shared_ptr<RecordBatchReader> &reader,
+                    const StopToken &) -> Result<int64_t> {
+    int64_t total = 0;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ARROW_RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (!batch) {
+        return total;
+      }
+      batch_sizes.push_back(batch->num_rows());
+      const auto &array = static_cast<const Int32Array &>(*batch->column(0));
+      for (int64_t i = 0; i < array.length(); ++i) {
+        ids.push_back(array.Value(i));
+      }
+      total += batch->num_rows();
+    }
+  };
+
+  FlightSqlBulkLoader loader(IdSchema(), ingest, 4, 1);
+  loader.Append(MakeIds(0, 3));
+  loader.Append(MakeIds(3, 3));
+  loader.Append(MakeIds(6, 5));
+
+  ASSERT_EQ(11, loader.Finish());
+  ASSERT_EQ(std::vector<int64_t>({4, 4, 3}), batch_sizes);
+  for (int32_t i = 0; i < 11; ++i) {
+    ASSERT_EQ(i, ids[i]);
+  }
+}
+
+TEST(BulkLoader, ReportsServerErrors) {
+  auto ingest = [](const std::shared_ptr<RecordBatchReader> &,
+                   const StopToken &) -> Result<int64_t> {
+    return Status::Invalid("Table is read-only");
+  };
+
+  // The rejected load stops draining the queue, so appending eventually fails.
+  FlightSqlBulkLoader loader(IdSchema(), ingest, 1, 1);
+  ASSERT_THROW(loader.Append(MakeIds(0, 5)), DriverException);
+}
+
+TEST(BulkLoader, AbandonedLoadIsCancelled) {
+  Status read_status;
+  auto ingest = [&](const std::shared_ptr<RecordBatchReader> &reader,
+                    const StopToken &) -> Result<int64_t> {
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      read_status = reader->ReadNext(&batch);
+    } while (read_status.ok() && batch);
+    return read_status.ok() ? Result<int64_t>(int64_t{0}) : Result<int64_t>(read_status);
+  };
+
+  {
+    FlightSqlBulkLoader loader(IdSchema(), ingest, 1, 4);
+    loader.Append(MakeIds(0, 2));
+  }
+
+  // Nothing is committed: the reader fails instead of ending the stream.
+  ASSERT_TRUE(read_status.IsCancelled());
+}
+
+} // namespace flight_sql
+} // namespace driver
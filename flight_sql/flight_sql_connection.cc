@@ -71,6 +71,17 @@ const std::string FlightSqlConnection::USE_EXTENDED_FLIGHTSQL_BUFFER = "UseExten
 const std::string FlightSqlConnection::USE_WIDE_CHAR = "UseWideChar";
 const std::string FlightSqlConnection::CHUNK_BUFFER_CAPACITY = "ChunkBufferCapacity";
 const std::string FlightSqlConnection::HIDE_SQL_TABLES_LISTING = "HideSQLTablesListing";
+const std::string FlightSqlConnection::CONVERSION_THREADS = "ConversionThreads";
+const std::string FlightSqlConnection::CONVERSION_TILE_ROWS = "ConversionTileRows";
+const std::string FlightSqlConnection::INGEST_BATCH_ROWS = "IngestBatchRows";
+const std::string FlightSqlConnection::INGEST_BUFFER_CAPACITY = "IngestBufferCapacity";
+const std::string FlightSqlConnection::PREPARED_STATEMENT_CACHE_SIZE = "PreparedStatementCacheSize";
+const std::string FlightSqlConnection::USE_POLL_FLIGHT_INFO = "UsePollFlightInfo";
+const std::string FlightSqlConnection::RESULT_CACHE_TIME_TO_LIVE_SECONDS = "ResultCacheTimeToLiveSeconds";
+const std::string FlightSqlConnection::RESULT_CACHE_MAX_MEGABYTES = "ResultCacheMaxMegabytes";
+const std::string FlightSqlConnection::RESULT_CACHE_COMPRESSION = "ResultCacheCompression";
+const std::string FlightSqlConnection::COALESCE_QUERIES = "CoalesceQueries";
+const std::string FlightSqlConnection::DEFER_PREPARE = "DeferPrepare";
 const std::string FlightSqlConnection::AUTH_TYPE = "authType";
 const std::string FlightSqlConnection::SEND_PING_FRAME = "SendPingFrame";
 const std::string FlightSqlConnection::PING_FRAME_INTERVAL_MS = "PingFrameIntervalMilliseconds";
@@ -83,8 +94,13 @@ const std::vector<std::string> FlightSqlConnection::ALL_KEYS = {
     FlightSqlConnection::USE_ENCRYPTION, FlightSqlConnection::TRUSTED_CERTS, FlightSqlConnection::USE_SYSTEM_TRUST_STORE,
     FlightSqlConnection::DISABLE_CERTIFICATE_VERIFICATION, FlightSqlConnection::STRING_COLUMN_LENGTH,
     FlightSqlConnection::USE_WIDE_CHAR, FlightSqlConnection::USE_EXTENDED_FLIGHTSQL_BUFFER, FlightSqlConnection::CHUNK_BUFFER_CAPACITY,
-    FlightSqlConnection::HIDE_SQL_TABLES_LISTING, FlightSqlConnection::AUTH_TYPE,
-    FlightSqlConnection::SEND_PING_FRAME,
+    FlightSqlConnection::HIDE_SQL_TABLES_LISTING, FlightSqlConnection::CONVERSION_THREADS,
+    FlightSqlConnection::CONVERSION_TILE_ROWS, FlightSqlConnection::INGEST_BATCH_ROWS,
+    FlightSqlConnection::INGEST_BUFFER_CAPACITY, FlightSqlConnection::PREPARED_STATEMENT_CACHE_SIZE,
+    FlightSqlConnection::USE_POLL_FLIGHT_INFO, FlightSqlConnection::RESULT_CACHE_TIME_TO_LIVE_SECONDS,
+    FlightSqlConnection::RESULT_CACHE_MAX_MEGABYTES, FlightSqlConnection::RESULT_CACHE_COMPRESSION,
+    FlightSqlConnection::COALESCE_QUERIES, FlightSqlConnection::DEFER_PREPARE,
+    FlightSqlConnection::AUTH_TYPE, FlightSqlConnection::SEND_PING_FRAME,
     FlightSqlConnection::PING_FRAME_INTERVAL_MS, FlightSqlConnection::PING_FRAME_TIMEOUT_MS,
     FlightSqlConnection::MAX_PINGS_WITHOUT_DATA};
 
@@ -142,6 +158,17 @@ const std::set<std::string, odbcabstraction::CaseInsensitiveComparator> BUILT_IN
     FlightSqlConnection::STRING_COLUMN_LENGTH,
     FlightSqlConnection::USE_WIDE_CHAR,
     FlightSqlConnection::USE_EXTENDED_FLIGHTSQL_BUFFER,
+    FlightSqlConnection::CONVERSION_THREADS,
+    FlightSqlConnection::CONVERSION_TILE_ROWS,
+    FlightSqlConnection::INGEST_BATCH_ROWS,
+    FlightSqlConnection::INGEST_BUFFER_CAPACITY,
+    FlightSqlConnection::PREPARED_STATEMENT_CACHE_SIZE,
+    FlightSqlConnection::USE_POLL_FLIGHT_INFO,
+    FlightSqlConnection::RESULT_CACHE_TIME_TO_LIVE_SECONDS,
+    FlightSqlConnection::RESULT_CACHE_MAX_MEGABYTES,
+    FlightSqlConnection::RESULT_CACHE_COMPRESSION,
+    FlightSqlConnection::COALESCE_QUERIES,
+    FlightSqlConnection::DEFER_PREPARE,
     FlightSqlConnection::AUTH_TYPE,
     FlightSqlConnection::SEND_PING_FRAME,
     FlightSqlConnection::PING_FRAME_INTERVAL_MS,
@@ -198,7 +225,9 @@ void FlightSqlConnection::Connect(const ConnPropertyMap &properties,
       FlightSqlAuthMethod::FromProperties(flight_client, properties);
     auth_method->Authenticate(*this, call_options_);
 
-    sql_client_.reset(new FlightSqlClient(std::move(flight_client)));
+    // Shared with the SQL client, for the Flight RPCs it does not wrap.
+    flight_client_ = std::move(flight_client);
+    sql_client_.reset(new FlightSqlClient(flight_client_));
     closed_ = false;
 
     // Note: This should likely come from Flight instead of being from the
@@ -209,9 +238,21 @@ void FlightSqlConnection::Connect(const ConnPropertyMap &properties,
 
     PopulateMetadataSettings(properties);
     PopulateCallOptions(properties);
+    prepared_statement_cache_ =
+        std::make_shared<PreparedStatementCache>(GetPreparedStatementCacheSize(properties));
+    const auto result_cache_time_to_live = GetResultCacheTimeToLive(properties);
+    if (result_cache_time_to_live.count() > 0) {
+      result_cache_ = std::make_shared<QueryResultCache>(
+          result_cache_time_to_live, GetResultCacheMaxBytes(properties),
+          GetResultCacheCompression(properties));
+    }
+    if (GetCoalesceQueries(properties)) {
+      query_coalescer_ = std::make_shared<QueryCoalescer>();
+    }
   } catch (...) {
     attribute_[CONNECTION_DEAD] = static_cast<uint32_t>(SQL_TRUE);
     sql_client_.reset();
+    flight_client_.reset();
 
     throw;
   }
@@ -223,6 +264,13 @@ void FlightSqlConnection::PopulateMetadataSettings(const Connection::ConnPropert
   metadata_settings_.use_extended_flightsql_buffer_ = GetUseExtendedFlightSQLBuffer(conn_property_map);
   metadata_settings_.chunk_buffer_capacity_ = GetChunkBufferCapacity(conn_property_map);
   metadata_settings_.hide_sql_tables_listing_ = GetHideSQLTablesListing(conn_property_map);
+  metadata_settings_.conversion_threads_ = GetConversionThreads(conn_property_map);
+  metadata_settings_.conversion_tile_rows_ = GetConversionTileRows(conn_property_map);
+  metadata_settings_.conversion_tiles_from_cache_ = GetConversionTilesFromCache(conn_property_map);
+  metadata_settings_.ingest_batch_rows_ = GetIngestBatchRows(conn_property_map);
+  metadata_settings_.ingest_buffer_capacity_ = GetIngestBufferCapacity(conn_property_map);
+  metadata_settings_.use_poll_flight_info_ = GetUsePollFlightInfo(conn_property_map);
+  metadata_settings_.defer_prepare_ = GetDeferPrepare(conn_property_map);
 }
 
 boost::optional<int32_t> FlightSqlConnection::GetStringColumnLength(const Connection::ConnPropertyMap &conn_property_map) {
@@ -275,6 +323,138 @@ bool FlightSqlConnection::GetHideSQLTablesListing(const ConnPropertyMap &connPro
   return AsBool(connPropertyMap, FlightSqlConnection::HIDE_SQL_TABLES_LISTING).value_or(default_value);
 }
 
+bool FlightSqlConnection::GetUsePollFlightInfo(const ConnPropertyMap &connPropertyMap) {
+  bool default_value = false;
+  return AsBool(connPropertyMap, FlightSqlConnection::USE_POLL_FLIGHT_INFO).value_or(default_value);
+}
+
+size_t FlightSqlConnection::GetConversionThreads(const ConnPropertyMap &connPropertyMap) {
+  size_t default_value = 1;
+  try {
+    return AsInt32(1, connPropertyMap, FlightSqlConnection::CONVERSION_THREADS).value_or(default_value);
+  } catch (const std::exception& e) {
+    diagnostics_.AddWarning(
+            std::string("Invalid value for connection property " + FlightSqlConnection::CONVERSION_THREADS +
+                        ". Please ensure it has a valid numeric value. Message: " + e.what()),
+            "01000", odbcabstraction::ODBCErrorCodes_GENERAL_WARNING);
+  }
+
+  return default_value;
+}
+
+size_t FlightSqlConnection::GetConversionTileRows(const ConnPropertyMap &connPropertyMap) {
+  // Zero converts each column through the whole rowset.
+  size_t default_value = 0;
+  if (GetConversionTilesFromCache(connPropertyMap)) {
+    return default_value;
+  }
+  try {
+    return AsInt32(0, connPropertyMap, FlightSqlConnection::CONVERSION_TILE_ROWS).value_or(default_value);
+  } catch (const std::exception& e) {
+    diagnostics_.AddWarning(
+            std::string("Invalid value for connection property " + FlightSqlConnection::CONVERSION_TILE_ROWS +
+                        ". Please ensure it has a valid numeric value. Message: " + e.what()),
+            "01000", odbcabstraction::ODBCErrorCodes_GENERAL_WARNING);
+  }
+
+  return default_value;
+}
+
+bool FlightSqlConnection::GetConversionTilesFromCache(const ConnPropertyMap &connPropertyMap) {
+  auto tile_rows_iterator = connPropertyMap.find(FlightSqlConnection::CONVERSION_TILE_ROWS);
+  return tile_rows_iterator != connPropertyMap.end() &&
+         boost::iequals(tile_rows_iterator->second, "auto");
+}
+
+size_t FlightSqlConnection::GetIngestBatchRows(const ConnPropertyMap &connPropertyMap) {
+  size_t default_value = 65536;
+  try {
+    return AsInt32(1, connPropertyMap, FlightSqlConnection::INGEST_BATCH_ROWS).value_or(default_value);
+  } catch (const std::exception& e) {
+    diagnostics_.AddWarning(
+            std::string("Invalid value for connection property " + FlightSqlConnection::INGEST_BATCH_ROWS +
+                        ". Please ensure it has a valid numeric value. Message: " + e.what()),
+            "01000", odbcabstraction::ODBCErrorCodes_GENERAL_WARNING);
+  }
+
+  return default_value;
+}
+
+size_t FlightSqlConnection::GetIngestBufferCapacity(const ConnPropertyMap &connPropertyMap) {
+  size_t default_value = 4;
+  try {
+    return AsInt32(1, connPropertyMap, FlightSqlConnection::INGEST_BUFFER_CAPACITY).value_or(default_value);
+  } catch (const std::exception& e) {
+    diagnostics_.AddWarning(
+            std::string("Invalid value for connection property " + FlightSqlConnection::INGEST_BUFFER_CAPACITY +
+                        ". Please ensure it has a valid numeric value. Message: " + e.what()),
+            "01000", odbcabstraction::ODBCErrorCodes_GENERAL_WARNING);
+  }
+
+  return default_value;
+}
+
+size_t FlightSqlConnection::GetPreparedStatementCacheSize(const ConnPropertyMap &connPropertyMap) {
+  // Zero disables the cache.
+  size_t default_value = 32;
+  try {
+    return AsInt32(0, connPropertyMap, FlightSqlConnection::PREPARED_STATEMENT_CACHE_SIZE).value_or(default_value);
+  } catch (const std::exception& e) {
+    diagnostics_.AddWarning(
+            std::string("Invalid value for connection property " + FlightSqlConnection::PREPARED_STATEMENT_CACHE_SIZE +
+                        ". Please ensure it has a valid numeric value. Message: " + e.what()),
+            "01000", odbcabstraction::ODBCErrorCodes_GENERAL_WARNING);
+  }
+
+  return default_value;
+}
+
+std::chrono::seconds FlightSqlConnection::GetResultCacheTimeToLive(const ConnPropertyMap &connPropertyMap) {
+  // Zero disables the cache.
+  int32_t default_value = 0;
+  try {
+    return std::chrono::seconds(
+        AsInt32(0, connPropertyMap, FlightSqlConnection::RESULT_CACHE_TIME_TO_LIVE_SECONDS).value_or(default_value));
+  } catch (const std::exception& e) {
+    diagnostics_.AddWarning(
+            std::string("Invalid value for connection property " + FlightSqlConnection::RESULT_CACHE_TIME_TO_LIVE_SECONDS +
+                        ". Please ensure it has a valid numeric value. Message: " + e.what()),
+            "01000", odbcabstraction::ODBCErrorCodes_GENERAL_WARNING);
+  }
+
+  return std::chrono::seconds(default_value);
+}
+
+size_t FlightSqlConnection::GetResultCacheMaxBytes(const ConnPropertyMap &connPropertyMap) {
+  size_t default_value = 64;
+  size_t megabytes = default_value;
+  try {
+    megabytes = AsInt32(1, connPropertyMap, FlightSqlConnection::RESULT_CACHE_MAX_MEGABYTES).value_or(default_value);
+  } catch (const std::exception& e) {
+    diagnostics_.AddWarning(
+            std::string("Invalid value for connection property " + FlightSqlConnection::RESULT_CACHE_MAX_MEGABYTES +
+                        ". Please ensure it has a valid numeric value. Message: " + e.what()),
+            "01000", odbcabstraction::ODBCErrorCodes_GENERAL_WARNING);
+  }
+
+  return megabytes * 1024 * 1024;
+}
+
+bool FlightSqlConnection::GetResultCacheCompression(const ConnPropertyMap &connPropertyMap) {
+  bool default_value = false;
+  return AsBool(connPropertyMap, FlightSqlConnection::RESULT_CACHE_COMPRESSION).value_or(default_value);
+}
+
+bool FlightSqlConnection::GetDeferPrepare(const ConnPropertyMap &connPropertyMap) {
+  bool default_value = false;
+  return AsBool(connPropertyMap, FlightSqlConnection::DEFER_PREPARE).value_or(default_value);
+}
+
+bool FlightSqlConnection::GetCoalesceQueries(const ConnPropertyMap &connPropertyMap) {
+  bool default_value = false;
+  return AsBool(connPropertyMap, FlightSqlConnection::COALESCE_QUERIES).value_or(default_value);
+}
+
 bool FlightSqlConnection::GetSendPingFrame(const ConnPropertyMap &connPropertyMap) {
   bool default_value = false;
   return AsBool(connPropertyMap, FlightSqlConnection::SEND_PING_FRAME).value_or(default_value);
@@ -455,6 +635,11 @@ void FlightSqlConnection::Close() {
     throw DriverException("Connection already closed.");
   }
 
+  if (prepared_statement_cache_) {
+    // Statements closed from now on close their handles themselves.
+    ClosePreparedStatements(prepared_statement_cache_->Close(), call_options_);
+  }
+
   if (sql_client_) {
     // Notify the server to close the session
     arrow::flight::CloseSessionRequest request;
@@ -463,6 +648,9 @@ void FlightSqlConnection::Close() {
     sql_client_->Close();
   }
   sql_client_.reset();
+  flight_client_.reset();
+  result_cache_.reset();
+  query_coalescer_.reset();
   closed_ = true;
   attribute_[CONNECTION_DEAD] = static_cast<uint32_t>(SQL_TRUE);
 }
@@ -472,8 +660,12 @@ std::shared_ptr<Statement> FlightSqlConnection::CreateStatement() {
       new FlightSqlStatement(
               diagnostics_,
               *sql_client_,
+              flight_client_.get(),
               call_options_,
-              metadata_settings_
+              metadata_settings_,
+              prepared_statement_cache_,
+              result_cache_,
+              query_coalescer_
               )
       );
 }
@@ -486,6 +678,19 @@ bool FlightSqlConnection::SetAttribute(Connection::AttributeId attribute,
     return CheckIfSetToOnlyValidValue(value, static_cast<uint32_t>(SQL_MODE_READ_WRITE));
   case PACKET_SIZE:
     return CheckIfSetToOnlyValidValue(value, static_cast<uint32_t>(0));
+  case CURRENT_CATALOG:
+    // Earlier results may have resolved names against the previous catalog.
+    if (result_cache_) {
+      result_cache_->Clear();
+    }
+    if (query_coalescer_) {
+      query_coalescer_->Clear();
+    }
+    attribute_[attribute] = value;
+    return true;
+  case RESULT_CACHE_HITS:
+  case RESULT_CACHE_MISSES:
+    throw DriverException("Cannot set read-only attribute", "HY092");
   default:
     attribute_[attribute] = value;
     return true;
@@ -500,6 +705,12 @@ FlightSqlConnection::GetAttribute(Connection::AttributeId attribute) {
     return boost::make_optional(Attribute(static_cast<uint32_t>(SQL_MODE_READ_WRITE)));
   case PACKET_SIZE:
     return boost::make_optional(Attribute(static_cast<uint32_t>(0)));
+  case RESULT_CACHE_HITS:
+    return boost::make_optional(
+        Attribute(static_cast<uint32_t>(result_cache_ ? result_cache_->hits() : 0)));
+  case RESULT_CACHE_MISSES:
+    return boost::make_optional(
+        Attribute(static_cast<uint32_t>(result_cache_ ? result_cache_->misses() : 0)));
   default:
     const auto &it = attribute_.find(attribute);
     return boost::make_optional(it != attribute_.end(), it->second);
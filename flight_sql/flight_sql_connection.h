@@ -13,6 +13,9 @@
 #include <arrow/flight/sql/api.h>
 #include <vector>
 
+#include "flight_sql_prepared_statement_cache.h"
+#include "flight_sql_query_coalescer.h"
+#include "flight_sql_result_cache.h"
 #include "get_info_cache.h"
 #include "odbcabstraction/types.h"
 
@@ -36,7 +39,13 @@ private:
   std::map<AttributeId, Attribute> attribute_;
   arrow::flight::FlightClientOptions client_options_;
   arrow::flight::FlightCallOptions call_options_;
+  std::shared_ptr<arrow::flight::FlightClient> flight_client_;
   std::unique_ptr<arrow::flight::sql::FlightSqlClient> sql_client_;
+  std::shared_ptr<PreparedStatementCache> prepared_statement_cache_;
+  // Null unless the result cache is enabled.
+  std::shared_ptr<QueryResultCache> result_cache_;
+  // Null unless identical queries in flight are coalesced.
+  std::shared_ptr<QueryCoalescer> query_coalescer_;
   GetInfoCache info_;
   odbcabstraction::Diagnostics diagnostics_;
   odbcabstraction::OdbcVersion odbc_version_;
@@ -65,6 +74,17 @@ public:
   static const std::string USE_EXTENDED_FLIGHTSQL_BUFFER;
   static const std::string CHUNK_BUFFER_CAPACITY;
   static const std::string HIDE_SQL_TABLES_LISTING;
+  static const std::string CONVERSION_THREADS;
+  static const std::string CONVERSION_TILE_ROWS;
+  static const std::string INGEST_BATCH_ROWS;
+  static const std::string INGEST_BUFFER_CAPACITY;
+  static const std::string PREPARED_STATEMENT_CACHE_SIZE;
+  static const std::string USE_POLL_FLIGHT_INFO;
+  static const std::string RESULT_CACHE_TIME_TO_LIVE_SECONDS;
+  static const std::string RESULT_CACHE_MAX_MEGABYTES;
+  static const std::string RESULT_CACHE_COMPRESSION;
+  static const std::string COALESCE_QUERIES;
+  static const std::string DEFER_PREPARE;
   static const std::string AUTH_TYPE;
   static const std::string SEND_PING_FRAME;
   static const std::string PING_FRAME_INTERVAL_MS;
@@ -120,6 +140,30 @@ public:
 
   bool GetHideSQLTablesListing(const ConnPropertyMap &connPropertyMap);
 
+  bool GetUsePollFlightInfo(const ConnPropertyMap &connPropertyMap);
+
+  bool GetDeferPrepare(const ConnPropertyMap &connPropertyMap);
+
+  size_t GetConversionThreads(const ConnPropertyMap &connPropertyMap);
+
+  size_t GetConversionTileRows(const ConnPropertyMap &connPropertyMap);
+
+  bool GetConversionTilesFromCache(const ConnPropertyMap &connPropertyMap);
+
+  size_t GetIngestBatchRows(const ConnPropertyMap &connPropertyMap);
+
+  size_t GetIngestBufferCapacity(const ConnPropertyMap &connPropertyMap);
+
+  size_t GetPreparedStatementCacheSize(const ConnPropertyMap &connPropertyMap);
+
+  std::chrono::seconds GetResultCacheTimeToLive(const ConnPropertyMap &connPropertyMap);
+
+  size_t GetResultCacheMaxBytes(const ConnPropertyMap &connPropertyMap);
+
+  bool GetResultCacheCompression(const ConnPropertyMap &connPropertyMap);
+
+  bool GetCoalesceQueries(const ConnPropertyMap &connPropertyMap);
+
   static bool GetSendPingFrame(const ConnPropertyMap &connPropertyMap);
 
   static boost::optional<int> GetPingFrameIntervalMilliseconds(const ConnPropertyMap &connPropertyMap);
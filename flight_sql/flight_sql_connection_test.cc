@@ -92,6 +92,156 @@ TEST(MetadataSettingsTest, UseWideCharTest) {
   connection.Close();
 }
 
+TEST(MetadataSettingsTest, ConversionThreadsTest) {
+  FlightSqlConnection connection(odbcabstraction::V_3);
+  connection.SetClosed(false);
+
+  const Connection::ConnPropertyMap properties1 = {
+          {FlightSqlConnection::CONVERSION_THREADS, std::string("4")},
+  };
+  const Connection::ConnPropertyMap properties2 = {
+          {FlightSqlConnection::CONVERSION_THREADS, std::string("0")},
+  };
+
+  EXPECT_EQ(4, connection.GetConversionThreads(properties1));
+  // Values below the minimum fall back to converting on the calling thread.
+  EXPECT_EQ(1, connection.GetConversionThreads(properties2));
+  EXPECT_EQ(1, connection.GetConversionThreads({}));
+
+  connection.Close();
+}
+
+TEST(MetadataSettingsTest, ConversionTileRowsTest) {
+  FlightSqlConnection connection(odbcabstraction::V_3);
+  connection.SetClosed(false);
+
+  const Connection::ConnPropertyMap properties1 = {
+          {FlightSqlConnection::CONVERSION_TILE_ROWS, std::string("512")},
+  };
+  const Connection::ConnPropertyMap properties2 = {
+          {FlightSqlConnection::CONVERSION_TILE_ROWS, std::string("-1")},
+  };
+
+  const Connection::ConnPropertyMap properties3 = {
+          {FlightSqlConnection::CONVERSION_TILE_ROWS, std::string("Auto")},
+  };
+
+  EXPECT_EQ(512, connection.GetConversionTileRows(properties1));
+  // Zero, and values below it, convert each column through the whole rowset.
+  EXPECT_EQ(0, connection.GetConversionTileRows(properties2));
+  EXPECT_EQ(0, connection.GetConversionTileRows({}));
+  EXPECT_EQ(0, connection.GetConversionTileRows(properties3));
+
+  EXPECT_FALSE(connection.GetConversionTilesFromCache(properties1));
+  EXPECT_FALSE(connection.GetConversionTilesFromCache({}));
+  EXPECT_TRUE(connection.GetConversionTilesFromCache(properties3));
+
+  connection.Close();
+}
+
+TEST(MetadataSettingsTest, IngestSettingsTest) {
+  FlightSqlConnection connection(odbcabstraction::V_3);
+  connection.SetClosed(false);
+
+  const Connection::ConnPropertyMap properties1 = {
+          {FlightSqlConnection::INGEST_BATCH_ROWS, std::string("1000")},
+          {FlightSqlConnection::INGEST_BUFFER_CAPACITY, std::string("8")},
+  };
+  const Connection::ConnPropertyMap properties2 = {
+          {FlightSqlConnection::INGEST_BATCH_ROWS, std::string("0")},
+          {FlightSqlConnection::INGEST_BUFFER_CAPACITY, std::string("0")},
+  };
+
+  EXPECT_EQ(1000, connection.GetIngestBatchRows(properties1));
+  EXPECT_EQ(8, connection.GetIngestBufferCapacity(properties1));
+  EXPECT_EQ(65536, connection.GetIngestBatchRows(properties2));
+  EXPECT_EQ(4, connection.GetIngestBufferCapacity(properties2));
+
+  connection.Close();
+}
+
+TEST(MetadataSettingsTest, PreparedStatementCacheSizeTest) {
+  FlightSqlConnection connection(odbcabstraction::V_3);
+  connection.SetClosed(false);
+
+  const Connection::ConnPropertyMap properties1 = {
+          {FlightSqlConnection::PREPARED_STATEMENT_CACHE_SIZE, std::string("0")},
+  };
+  const Connection::ConnPropertyMap properties2 = {
+          {FlightSqlConnection::PREPARED_STATEMENT_CACHE_SIZE, std::string("-1")},
+  };
+
+  // Zero disables the cache.
+  EXPECT_EQ(0, connection.GetPreparedStatementCacheSize(properties1));
+  EXPECT_EQ(32, connection.GetPreparedStatementCacheSize(properties2));
+  EXPECT_EQ(32, connection.GetPreparedStatementCacheSize({}));
+
+  connection.Close();
+}
+
+TEST(MetadataSettingsTest, UsePollFlightInfoTest) {
+  FlightSqlConnection connection(odbcabstraction::V_3);
+  connection.SetClosed(false);
+
+  const Connection::ConnPropertyMap properties = {
+          {FlightSqlConnection::USE_POLL_FLIGHT_INFO, std::string("true")},
+  };
+
+  EXPECT_TRUE(connection.GetUsePollFlightInfo(properties));
+  EXPECT_FALSE(connection.GetUsePollFlightInfo({}));
+
+  connection.Close();
+}
+
+TEST(MetadataSettingsTest, DeferPrepareTest) {
+  FlightSqlConnection connection(odbcabstraction::V_3);
+  connection.SetClosed(false);
+
+  const Connection::ConnPropertyMap properties = {
+          {FlightSqlConnection::DEFER_PREPARE, std::string("true")},
+  };
+
+  EXPECT_TRUE(connection.GetDeferPrepare(properties));
+  EXPECT_FALSE(connection.GetDeferPrepare({}));
+
+  connection.Close();
+}
+
+TEST(MetadataSettingsTest, ResultCacheTest) {
+  FlightSqlConnection connection(odbcabstraction::V_3);
+  connection.SetClosed(false);
+
+  const Connection::ConnPropertyMap properties = {
+          {FlightSqlConnection::RESULT_CACHE_TIME_TO_LIVE_SECONDS, std::string("30")},
+          {FlightSqlConnection::RESULT_CACHE_MAX_MEGABYTES, std::string("2")},
+          {FlightSqlConnection::RESULT_CACHE_COMPRESSION, std::string("true")},
+  };
+
+  EXPECT_EQ(std::chrono::seconds(30), connection.GetResultCacheTimeToLive(properties));
+  EXPECT_EQ(2 * 1024 * 1024, connection.GetResultCacheMaxBytes(properties));
+  EXPECT_TRUE(connection.GetResultCacheCompression(properties));
+
+  EXPECT_EQ(std::chrono::seconds(0), connection.GetResultCacheTimeToLive({}));
+  EXPECT_EQ(64 * 1024 * 1024, connection.GetResultCacheMaxBytes({}));
+  EXPECT_FALSE(connection.GetResultCacheCompression({}));
+
+  connection.Close();
+}
+
+TEST(MetadataSettingsTest, CoalesceQueriesTest) {
+  FlightSqlConnection connection(odbcabstraction::V_3);
+  connection.SetClosed(false);
+
+  const Connection::ConnPropertyMap properties = {
+          {FlightSqlConnection::COALESCE_QUERIES, std::string("true")},
+  };
+
+  EXPECT_TRUE(connection.GetCoalesceQueries(properties));
+  EXPECT_FALSE(connection.GetCoalesceQueries({}));
+
+  connection.Close();
+}
+
 TEST(BuildLocationTests, ForTcp) {
   std::vector<std::string> missing_attr;
   Connection::ConnPropertyMap properties = {
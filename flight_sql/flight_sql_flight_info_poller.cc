@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_flight_info_poller.h"
+
+#include "utils.h"
+#include <arrow/flight/sql/client.h>
+#include <odbcabstraction/exceptions.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+namespace driver {
+namespace flight_sql {
+
+using arrow::flight::FlightCallOptions;
+using arrow::flight::FlightClient;
+using arrow::flight::FlightDescriptor;
+using arrow::flight::FlightEndpoint;
+using arrow::flight::FlightInfo;
+using arrow::flight::PollInfo;
+using odbcabstraction::DriverException;
+
+namespace {
+
+// Servers should hold polls until something changes; this only keeps one
+// that answers right away from being flooded.
+const std::chrono::milliseconds POLL_INTERVAL(100);
+
+// Arrow stop tokens cannot be waited on, so waits check them this often.
+const std::chrono::milliseconds STOP_CHECK_INTERVAL(10);
+
+/// Flight SQL client that records the command it would send instead of
+/// sending it, so commands are serialized by Arrow's own messages.
+class CommandRecorder : public arrow::flight::sql::FlightSqlClient {
+public:
+  CommandRecorder() : FlightSqlClient(nullptr) {}
+
+  const std::string &command() const { return command_; }
+
+protected:
+  arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfo(
+      const FlightCallOptions &, const FlightDescriptor &descriptor) override {
+    command_ = descriptor.cmd;
+    return arrow::Status::Cancelled("The command is only recorded");
+  }
+
+private:
+  std::string command_;
+};
+
+/// Sleeps until `deadline`, throwing HY008 as soon as `stop_token` fires.
+void WaitUntil(std::chrono::steady_clock::time_point deadline,
+               const arrow::StopToken &stop_token) {
+  while (!stop_token.IsStopRequested()) {
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+      return;
+    }
+    std::this_thread::sleep_for(
+        std::min<std::chrono::steady_clock::duration>(deadline - now, STOP_CHECK_INTERVAL));
+  }
+  throw DriverException("Operation canceled", "HY008");
+}
+
+} // namespace
+
+std::string SerializeStatementQueryCommand(const std::string &query) {
+  // The descriptor FlightSqlClient::Execute would get the FlightInfo for.
+  CommandRecorder recorder;
+  (void)recorder.Execute(FlightCallOptions(), query);
+  if (recorder.command().empty()) {
+    throw DriverException("Cannot serialize the query command", "HY000");
+  }
+  return recorder.command();
+}
+
+FlightInfoPoller::FlightInfoPoller(PollFunction poll, FlightCallOptions call_options,
+                                   std::unique_ptr<PollInfo> poll_info)
+    : poll_(std::move(poll)), call_options_(std::move(call_options)),
+      stop_token_(call_options_.stop_token), poll_info_(std::move(poll_info)),
+      flight_info_(std::make_shared<FlightInfo>(*poll_info_->info)),
+      endpoints_returned_(flight_info_->endpoints().size()) {
+  call_options_.stop_token = stop_source_.token();
+  UpdateProgress();
+}
+
+std::shared_ptr<FlightInfoPoller> FlightInfoPoller::Start(FlightClient &client,
+                                                          const FlightCallOptions &call_options,
+                                                          const std::string &query) {
+  return Start(
+      [&client](const FlightCallOptions &options, const FlightDescriptor &descriptor) {
+        return client.PollFlightInfo(options, descriptor);
+      },
+      call_options, query);
+}
+
+std::shared_ptr<FlightInfoPoller> FlightInfoPoller::Start(PollFunction poll,
+                                                          const FlightCallOptions &call_options,
+                                                          const std::string &query) {
+  auto polled_at = std::chrono::steady_clock::now();
+  auto result =
+      poll(call_options, FlightDescriptor::Command(SerializeStatementQueryCommand(query)));
+  if (result.status().IsNotImplemented()) {
+    return nullptr;
+  }
+  ThrowIfNotOK(result.status());
+  std::unique_ptr<PollInfo> poll_info = std::move(result).ValueOrDie();
+
+  // The schema comes with the first results the server publishes.
+  while (!poll_info->info && poll_info->descriptor) {
+    WaitUntil(polled_at + POLL_INTERVAL, call_options.stop_token);
+    polled_at = std::chrono::steady_clock::now();
+    result = poll(call_options, *poll_info->descriptor);
+    ThrowIfNotOK(result.status());
+    poll_info = std::move(result).ValueOrDie();
+  }
+  if (!poll_info->info) {
+    throw DriverException("The server completed the query without describing its results", "HY000");
+  }
+
+  return std::make_shared<FlightInfoPoller>(std::move(poll), call_options, std::move(poll_info));
+}
+
+bool FlightInfoPoller::Next(std::vector<FlightEndpoint> *endpoints) {
+  while (true) {
+    if (stop_token_.IsStopRequested()) {
+      throw DriverException("Operation canceled", "HY008");
+    }
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return false;
+      }
+    }
+
+    if (poll_info_->info) {
+      const auto &published = poll_info_->info->endpoints();
+      if (published.size() > endpoints_returned_) {
+        endpoints->assign(published.begin() + endpoints_returned_, published.end());
+        endpoints_returned_ = published.size();
+        return true;
+      }
+    }
+    if (!poll_info_->descriptor) {
+      return false;
+    }
+
+    const auto polled_at = std::chrono::steady_clock::now();
+    auto result = poll_(call_options_, *poll_info_->descriptor);
+    if (!result.ok()) {
+      // A poll interrupted by Stop or the caller fails; the loop reports why.
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (stopped_ || stop_token_.IsStopRequested()) {
+        continue;
+      }
+    }
+    ThrowIfNotOK(result.status());
+    const size_t previous_endpoints = endpoints_returned_;
+    poll_info_ = std::move(result).ValueOrDie();
+    UpdateProgress();
+
+    if (poll_info_->descriptor &&
+        (!poll_info_->info || poll_info_->info->endpoints().size() <= previous_endpoints)) {
+      // Arrow stop tokens cannot be waited on, so the caller's is checked
+      // while waiting.
+      std::unique_lock<std::mutex> lock(mutex_);
+      const auto deadline = polled_at + POLL_INTERVAL;
+      while (!stopped_ && !stop_token_.IsStopRequested() &&
+             std::chrono::steady_clock::now() < deadline) {
+        stopped_changed_.wait_until(
+            lock, std::min(deadline, std::chrono::steady_clock::now() + STOP_CHECK_INTERVAL));
+      }
+    }
+  }
+}
+
+void FlightInfoPoller::Stop() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+    stopped_changed_.notify_all();
+  }
+  stop_source_.RequestStop();
+}
+
+void FlightInfoPoller::UpdateProgress() {
+  if (!poll_info_->descriptor) {
+    progress_ = 1;
+  } else if (poll_info_->progress) {
+    progress_ = *poll_info_->progress;
+  }
+}
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include <arrow/flight/client.h>
+#include <arrow/flight/types.h>
+#include <arrow/util/cancel.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace driver {
+namespace flight_sql {
+
+/// Serializes the Flight SQL command executing `query`, as the command of a
+/// FlightDescriptor.
+std::string SerializeStatementQueryCommand(const std::string &query);
+
+/// Follows a query the server is still running through PollFlightInfo, so
+/// the endpoints of finished partitions can be read before the query ends.
+class FlightInfoPoller {
+public:
+  /// Sends one PollFlightInfo request, like FlightClient::PollFlightInfo.
+  typedef std::function<arrow::Result<std::unique_ptr<arrow::flight::PollInfo>>(
+      const arrow::flight::FlightCallOptions &, const arrow::flight::FlightDescriptor &)>
+      PollFunction;
+
+  FlightInfoPoller(PollFunction poll, arrow::flight::FlightCallOptions call_options,
+                   std::unique_ptr<arrow::flight::PollInfo> poll_info);
+
+  /// Starts executing `query`, waiting until the server publishes the result
+  /// schema. Returns null when the server does not support PollFlightInfo.
+  /// Throws HY008 when the stop token of `call_options` fires while waiting.
+  static std::shared_ptr<FlightInfoPoller> Start(arrow::flight::FlightClient &client,
+                                                 const arrow::flight::FlightCallOptions &call_options,
+                                                 const std::string &query);
+
+  static std::shared_ptr<FlightInfoPoller> Start(PollFunction poll,
+                                                 const arrow::flight::FlightCallOptions &call_options,
+                                                 const std::string &query);
+
+  /// The results published when the poller was created.
+  const std::shared_ptr<arrow::flight::FlightInfo> &flight_info() const { return flight_info_; }
+
+  /// Waits for the server to publish endpoints beyond those of `flight_info`
+  /// and previous calls.
+  /// \return false once the query completed and every endpoint was returned,
+  /// or once the poller was stopped.
+  /// Throws HY008 once the stop token of the call options the poller was
+  /// created with fires.
+  bool Next(std::vector<arrow::flight::FlightEndpoint> *endpoints);
+
+  /// Fraction of the query the server completed, from 0 to 1.
+  double progress() const { return progress_; }
+
+  /// Makes `Next` return false, interrupting a poll in progress. Callers
+  /// interrupting the query fire their stop token first, so `Next` throws.
+  void Stop();
+
+private:
+  void UpdateProgress();
+
+  PollFunction poll_;
+  // Polls stop on stop_source_, so that Stop interrupts them too.
+  arrow::flight::FlightCallOptions call_options_;
+  arrow::StopSource stop_source_;
+  // Stop token of the caller.
+  arrow::StopToken stop_token_;
+  std::unique_ptr<arrow::flight::PollInfo> poll_info_;
+  std::shared_ptr<arrow::flight::FlightInfo> flight_info_;
+  size_t endpoints_returned_;
+  std::atomic<double> progress_{0};
+
+  std::mutex mutex_;
+  std::condition_variable stopped_changed_;
+  bool stopped_ = false;
+};
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_flight_info_poller.h"
+#include "gtest/gtest.h"
+#include <odbcabstraction/exceptions.h>
+
+#include <chrono>
+#include <thread>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow::flight;
+using odbcabstraction::DriverException;
+
+namespace {
+
+const std::string TYPE_URL = "type.googleapis.com/arrow.flight.protocol.sql.CommandStatementQuery";
+
+/// Server publishing the results of a query from the poll numbered
+/// `published_at` on, counting the polls.
+FlightInfoPoller::PollFunction FakeServer(int published_at, int *polls) {
+  return [published_at, polls](const FlightCallOptions &, const FlightDescriptor &)
+             -> arrow::Result<std::unique_ptr<PollInfo>> {
+    auto poll_info = std::make_unique<PollInfo>();
+    poll_info->descriptor = FlightDescriptor::Command("running");
+    if (++*polls >= published_at) {
+      ARROW_ASSIGN_OR_RAISE(
+          FlightInfo info,
+          FlightInfo::Make(*arrow::schema({arrow::field("id", arrow::int32())}),
+                           *poll_info->descriptor, {}, -1, -1));
+      poll_info->info = std::make_unique<FlightInfo>(std::move(info));
+    }
+    return poll_info;
+  };
+}
+
+} // namespace
+
+TEST(FlightInfoPoller, SerializesStatementQueryCommand) {
+  // google.protobuf.Any wrapping a CommandStatementQuery holding the query.
+  std::string expected;
+  expected += '\x0A';
+  expected += static_cast<char>(TYPE_URL.size());
+  expected += TYPE_URL;
+  expected += "\x12\x0A\x0A\x08SELECT 1";
+
+  ASSERT_EQ(expected, SerializeStatementQueryCommand("SELECT 1"));
+}
+
+TEST(FlightInfoPoller, StartWaitsBetweenPollsUntilResultsArePublished) {
+  int polls = 0;
+  const auto started_at = std::chrono::steady_clock::now();
+  auto poller = FlightInfoPoller::Start(FakeServer(3, &polls), FlightCallOptions(), "SELECT 1");
+  const auto elapsed = std::chrono::steady_clock::now() - started_at;
+
+  ASSERT_NE(nullptr, poller);
+  ASSERT_EQ(3, polls);
+  // Two waits of the 100 ms poll interval, with some slack for the clock.
+  ASSERT_GE(elapsed, std::chrono::milliseconds(150));
+}
+
+TEST(FlightInfoPoller, StartStopsWaitingWhenTheStatementIsInterrupted) {
+  arrow::StopSource stop_source;
+  FlightCallOptions call_options;
+  call_options.stop_token = stop_source.token();
+  int polls = 0;
+  auto server = FakeServer(3, &polls);
+
+  try {
+    FlightInfoPoller::Start(
+        [&](const FlightCallOptions &options, const FlightDescriptor &descriptor) {
+          stop_source.RequestStop();
+          return server(options, descriptor);
+        },
+        call_options, "SELECT 1");
+    FAIL() << "Start returned after the statement was interrupted";
+  } catch (const DriverException &e) {
+    ASSERT_EQ("HY008", e.GetSqlState());
+  }
+  ASSERT_EQ(1, polls);
+}
+
+TEST(FlightInfoPoller, NextThrowsOnceTheStatementIsInterrupted) {
+  arrow::StopSource stop_source;
+  FlightCallOptions call_options;
+  call_options.stop_token = stop_source.token();
+  int polls = 0;
+  auto poller = FlightInfoPoller::Start(FakeServer(1, &polls), call_options, "SELECT 1");
+  ASSERT_NE(nullptr, poller);
+
+  // The query keeps running without publishing endpoints, so Next keeps
+  // polling until the statement is interrupted.
+  std::thread interrupter([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    stop_source.RequestStop();
+  });
+  std::vector<FlightEndpoint> endpoints;
+  try {
+    poller->Next(&endpoints);
+    FAIL() << "Next returned after the statement was interrupted";
+  } catch (const DriverException &e) {
+    ASSERT_EQ("HY008", e.GetSqlState());
+  }
+  interrupter.join();
+}
+
+} // namespace flight_sql
+} // namespace driver
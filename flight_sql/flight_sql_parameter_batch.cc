@@ -0,0 +1,560 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_parameter_batch.h"
+
+#include "utils.h"
+#include <arrow/builder.h>
+#include <arrow/compute/api.h>
+#include <arrow/compute/initialize.h>
+#include <arrow/extension_type.h>
+#include <arrow/util/checked_cast.h>
+#include <arrow/util/decimal.h>
+#include <arrow/util/endian.h>
+#include <odbcabstraction/encoding.h>
+#include <odbcabstraction/platform.h>
+#include <sql.h>
+#include <sqlext.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace driver {
+namespace flight_sql {
+
+using arrow::Array;
+using arrow::DataType;
+using namespace odbcabstraction;
+
+namespace {
+
+constexpr int32_t MAX_DECIMAL_PRECISION = 38;
+constexpr int64_t SECONDS_PER_DAY = 86400;
+
+/// Size of one value in a column-wise bound parameter array.
+size_t GetCellLength(const ParameterBinding &binding) {
+  switch (binding.target_type) {
+  case CDataType_CHAR:
+  case CDataType_WCHAR:
+  case CDataType_BINARY:
+    return binding.buffer_length;
+  case CDataType_BIT:
+  case CDataType_STINYINT:
+  case CDataType_UTINYINT:
+    return sizeof(int8_t);
+  case CDataType_SSHORT:
+  case CDataType_USHORT:
+    return sizeof(int16_t);
+  case CDataType_SLONG:
+  case CDataType_ULONG:
+    return sizeof(int32_t);
+  case CDataType_SBIGINT:
+  case CDataType_UBIGINT:
+    return sizeof(int64_t);
+  case CDataType_FLOAT:
+    return sizeof(float);
+  case CDataType_DOUBLE:
+    return sizeof(double);
+  case CDataType_DATE:
+    return sizeof(DATE_STRUCT);
+  case CDataType_TIME:
+    return sizeof(TIME_STRUCT);
+  case CDataType_TIMESTAMP:
+    return sizeof(TIMESTAMP_STRUCT);
+  case CDataType_NUMERIC:
+    return sizeof(SQL_NUMERIC_STRUCT);
+  case CDataType_GUID:
+    return sizeof(SQLGUID);
+  default:
+    throw DriverException("Unsupported parameter C data type: " +
+                              std::to_string(binding.target_type),
+                          "HY003");
+  }
+}
+
+/// Reads the values of one bound parameter, one parameter set at a time.
+class ParameterReader {
+public:
+  ParameterReader(const ParameterBinding &binding, size_t bind_offset, size_t bind_type)
+      : binding_(binding), cell_length_(GetCellLength(binding)) {
+    binding_.row_stride = bind_type;
+    if (binding_.buffer) {
+      binding_.buffer = static_cast<uint8_t *>(binding_.buffer) + bind_offset;
+    }
+    if (binding_.strlen_buffer) {
+      binding_.strlen_buffer = reinterpret_cast<ssize_t *>(
+          reinterpret_cast<uint8_t *>(binding_.strlen_buffer) + bind_offset);
+    }
+  }
+
+  /// True when the values are packed one after another with no indicators,
+  /// so a run of parameter sets can be copied at once.
+  bool IsPacked() const { return binding_.row_stride == 0 && binding_.strlen_buffer == nullptr; }
+
+  const ParameterBinding &GetBinding() const { return binding_; }
+
+  const uint8_t *GetFirstValue() const { return static_cast<const uint8_t *>(binding_.buffer); }
+
+  /// Returns the value of parameter set \p row, or null when it is NULL.
+  const uint8_t *GetValue(size_t row) const {
+    const ssize_t indicator = GetIndicator(row);
+    if (indicator == SQL_NULL_DATA) {
+      return nullptr;
+    }
+    if (indicator == SQL_DATA_AT_EXEC || indicator <= SQL_LEN_DATA_AT_EXEC_OFFSET) {
+      throw DriverException("Data-at-execution parameters are not supported", "HYC00");
+    }
+    if (indicator == SQL_DEFAULT_PARAM) {
+      throw DriverException("Invalid use of default parameter", "07S01");
+    }
+    if (!binding_.buffer) {
+      throw DriverException("Invalid use of null pointer", "HY009");
+    }
+    return static_cast<const uint8_t *>(binding_.GetCellBuffer(static_cast<int64_t>(row),
+                                                               cell_length_));
+  }
+
+  /// Returns the length in bytes of the CHAR or BINARY value of set \p row.
+  size_t GetByteLength(size_t row, const uint8_t *value) const {
+    const ssize_t indicator = GetIndicator(row);
+    if (indicator >= 0) {
+      return static_cast<size_t>(indicator);
+    }
+    if (indicator != SQL_NTS || binding_.target_type == CDataType_BINARY) {
+      if (binding_.target_type == CDataType_BINARY && !binding_.strlen_buffer) {
+        return binding_.buffer_length;
+      }
+      throw DriverException("Invalid string or buffer length", "HY090");
+    }
+    const char *text = reinterpret_cast<const char *>(value);
+    return binding_.buffer_length > 0 ? strnlen(text, binding_.buffer_length) : strlen(text);
+  }
+
+  /// Returns the length in code units of the WCHAR value of set \p row.
+  size_t GetWideLength(size_t row, const uint8_t *value) const {
+    const ssize_t indicator = GetIndicator(row);
+    if (indicator >= 0) {
+      return static_cast<size_t>(indicator) / GetSqlWCharSize();
+    }
+    if (indicator != SQL_NTS) {
+      throw DriverException("Invalid string or buffer length", "HY090");
+    }
+    const size_t max_length =
+        binding_.buffer_length > 0 ? binding_.buffer_length / GetSqlWCharSize() : SIZE_MAX;
+    size_t length = 0;
+    while (length < max_length && !IsWideTerminator(value + length * GetSqlWCharSize())) {
+      ++length;
+    }
+    return length;
+  }
+
+private:
+  ParameterBinding binding_;
+  size_t cell_length_;
+
+  ssize_t GetIndicator(size_t row) const {
+    return binding_.strlen_buffer ? *binding_.GetCellIndicator(static_cast<int64_t>(row))
+                                  : SQL_NTS;
+  }
+
+  static bool IsWideTerminator(const uint8_t *code_unit) {
+    for (size_t i = 0; i < GetSqlWCharSize(); ++i) {
+      if (code_unit[i] != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+template <typename BUILDER, typename APPEND>
+std::shared_ptr<Array> BuildArray(BUILDER &builder, const ParameterReader &reader,
+                                  const std::vector<size_t> &rows, APPEND append) {
+  ThrowIfNotOK(builder.Reserve(static_cast<int64_t>(rows.size())));
+  for (size_t row : rows) {
+    const uint8_t *value = reader.GetValue(row);
+    if (value) {
+      ThrowIfNotOK(append(value, row));
+    } else {
+      ThrowIfNotOK(builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> array;
+  ThrowIfNotOK(builder.Finish(&array));
+  return array;
+}
+
+template <typename ARROW_TYPE, typename C_TYPE>
+std::shared_ptr<Array> BuildPrimitiveArray(const ParameterReader &reader,
+                                           const std::vector<size_t> &rows, bool all_rows) {
+  using ValueType = typename ARROW_TYPE::c_type;
+  typename arrow::TypeTraits<ARROW_TYPE>::BuilderType builder;
+
+  // Column-wise arrays without indicators already have Arrow's layout.
+  if constexpr (std::is_same<ValueType, C_TYPE>::value) {
+    if (all_rows && reader.IsPacked() && reader.GetFirstValue()) {
+      ThrowIfNotOK(builder.AppendValues(reinterpret_cast<const C_TYPE *>(reader.GetFirstValue()),
+                                        static_cast<int64_t>(rows.size())));
+      std::shared_ptr<Array> array;
+      ThrowIfNotOK(builder.Finish(&array));
+      return array;
+    }
+  }
+
+  return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t) {
+    C_TYPE c_value;
+    std::memcpy(&c_value, value, sizeof(c_value));
+    builder.UnsafeAppend(static_cast<ValueType>(c_value));
+    return arrow::Status::OK();
+  });
+}
+
+/// Days since the UNIX epoch of a proleptic Gregorian date.
+int64_t DaysFromCivil(int64_t year, int64_t month, int64_t day) {
+  year -= month <= 2;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int64_t year_of_era = year - era * 400;
+  const int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+int64_t GetDays(SQLSMALLINT year, SQLUSMALLINT month, SQLUSMALLINT day) {
+  if (month < 1 || month > 12 || day < 1 || day > 31) {
+    throw DriverException("Invalid datetime format", "22007");
+  }
+  return DaysFromCivil(year, month, day);
+}
+
+int64_t GetSecondsOfDay(SQLUSMALLINT hour, SQLUSMALLINT minute, SQLUSMALLINT second) {
+  if (hour > 23 || minute > 59 || second > 59) {
+    throw DriverException("Invalid datetime format", "22007");
+  }
+  return hour * 3600 + minute * 60 + second;
+}
+
+int64_t GetUnitsPerSecond(arrow::TimeUnit::type unit) {
+  switch (unit) {
+  case arrow::TimeUnit::SECOND:
+    return 1;
+  case arrow::TimeUnit::MILLI:
+    return 1000;
+  case arrow::TimeUnit::MICRO:
+    return 1000000;
+  default:
+    return 1000000000;
+  }
+}
+
+std::shared_ptr<Array> BuildTimestampArray(const ParameterReader &reader,
+                                           const std::vector<size_t> &rows,
+                                           const std::shared_ptr<DataType> &target) {
+  // Build straight into the server's unit and time zone when it expects a
+  // timestamp, so no cast can drop the fraction.
+  const auto type = target && target->id() == arrow::Type::TIMESTAMP
+                        ? target
+                        : arrow::timestamp(arrow::TimeUnit::MICRO);
+  const auto unit = arrow::internal::checked_cast<const arrow::TimestampType &>(*type).unit();
+  const int64_t units_per_second = GetUnitsPerSecond(unit);
+
+  arrow::TimestampBuilder builder(type, arrow::default_memory_pool());
+  return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t) {
+    TIMESTAMP_STRUCT timestamp;
+    std::memcpy(&timestamp, value, sizeof(timestamp));
+    const int64_t seconds =
+        GetDays(timestamp.year, timestamp.month, timestamp.day) * SECONDS_PER_DAY +
+        GetSecondsOfDay(timestamp.hour, timestamp.minute, timestamp.second);
+    builder.UnsafeAppend(seconds * units_per_second +
+                         timestamp.fraction / (NANO_TO_SECONDS_DIVISOR / units_per_second));
+    return arrow::Status::OK();
+  });
+}
+
+/// Scale for a SQL_C_NUMERIC array: the server's, the declared one for
+/// DECIMAL and NUMERIC parameters, otherwise the largest used by any value.
+int32_t GetNumericScale(const ParameterReader &reader, const std::vector<size_t> &rows,
+                        const std::shared_ptr<DataType> &target) {
+  if (target && target->id() == arrow::Type::DECIMAL128) {
+    return arrow::internal::checked_cast<const arrow::Decimal128Type &>(*target).scale();
+  }
+  const auto sql_type = reader.GetBinding().sql_type;
+  if (sql_type == SQL_DECIMAL || sql_type == SQL_NUMERIC) {
+    return std::clamp(reader.GetBinding().scale, 0, MAX_DECIMAL_PRECISION);
+  }
+  int32_t scale = 0;
+  for (size_t row : rows) {
+    const uint8_t *value = reader.GetValue(row);
+    if (value) {
+      const auto &numeric = *reinterpret_cast<const SQL_NUMERIC_STRUCT *>(value);
+      scale = std::max<int32_t>(scale, numeric.scale);
+    }
+  }
+  return std::min(scale, MAX_DECIMAL_PRECISION);
+}
+
+std::shared_ptr<Array> BuildNumericArray(const ParameterReader &reader,
+                                         const std::vector<size_t> &rows,
+                                         const std::shared_ptr<DataType> &target) {
+  const int32_t scale = GetNumericScale(reader, rows, target);
+  arrow::Decimal128Builder builder(arrow::decimal128(MAX_DECIMAL_PRECISION, scale));
+  return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t) {
+    SQL_NUMERIC_STRUCT numeric;
+    std::memcpy(&numeric, value, sizeof(numeric));
+
+    uint64_t low, high;
+    std::memcpy(&low, numeric.val, sizeof(low));
+    std::memcpy(&high, numeric.val + sizeof(low), sizeof(high));
+    arrow::Decimal128 decimal(static_cast<int64_t>(arrow::bit_util::FromLittleEndian(high)),
+                              arrow::bit_util::FromLittleEndian(low));
+    if (numeric.sign == 0) {
+      decimal.Negate();
+    }
+
+    if (numeric.scale > scale) {
+      decimal = decimal.ReduceScaleBy(numeric.scale - scale, true);
+    } else if (numeric.scale < scale) {
+      auto rescaled = decimal.Rescale(numeric.scale, scale);
+      if (!rescaled.ok()) {
+        throw DriverException("Numeric value out of range", "22003");
+      }
+      decimal = *rescaled;
+    }
+    if (!decimal.FitsInPrecision(MAX_DECIMAL_PRECISION)) {
+      throw DriverException("Numeric value out of range", "22003");
+    }
+    builder.UnsafeAppend(decimal);
+    return arrow::Status::OK();
+  });
+}
+
+/// Builds the values of one parameter in the Arrow type closest to its C type.
+std::shared_ptr<Array> BuildValues(const ParameterReader &reader, const std::vector<size_t> &rows,
+                                   bool all_rows, const std::shared_ptr<DataType> &target) {
+  switch (reader.GetBinding().target_type) {
+  case CDataType_CHAR: {
+    arrow::StringBuilder builder;
+    return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t row) {
+      return builder.Append(value, static_cast<int32_t>(reader.GetByteLength(row, value)));
+    });
+  }
+  case CDataType_WCHAR: {
+    arrow::StringBuilder builder;
+    std::vector<uint8_t> utf8;
+    return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t row) {
+      WcsToUtf8(value, reader.GetWideLength(row, value), &utf8);
+      return builder.Append(utf8.data(), static_cast<int32_t>(utf8.size()));
+    });
+  }
+  case CDataType_BINARY: {
+    arrow::BinaryBuilder builder;
+    return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t row) {
+      return builder.Append(value, static_cast<int32_t>(reader.GetByteLength(row, value)));
+    });
+  }
+  case CDataType_BIT:
+    return BuildPrimitiveArray<arrow::BooleanType, uint8_t>(reader, rows, all_rows);
+  case CDataType_STINYINT:
+    return BuildPrimitiveArray<arrow::Int8Type, int8_t>(reader, rows, all_rows);
+  case CDataType_UTINYINT:
+    return BuildPrimitiveArray<arrow::UInt8Type, uint8_t>(reader, rows, all_rows);
+  case CDataType_SSHORT:
+    return BuildPrimitiveArray<arrow::Int16Type, int16_t>(reader, rows, all_rows);
+  case CDataType_USHORT:
+    return BuildPrimitiveArray<arrow::UInt16Type, uint16_t>(reader, rows, all_rows);
+  case CDataType_SLONG:
+    return BuildPrimitiveArray<arrow::Int32Type, int32_t>(reader, rows, all_rows);
+  case CDataType_ULONG:
+    return BuildPrimitiveArray<arrow::UInt32Type, uint32_t>(reader, rows, all_rows);
+  case CDataType_SBIGINT:
+    return BuildPrimitiveArray<arrow::Int64Type, int64_t>(reader, rows, all_rows);
+  case CDataType_UBIGINT:
+    return BuildPrimitiveArray<arrow::UInt64Type, uint64_t>(reader, rows, all_rows);
+  case CDataType_FLOAT:
+    return BuildPrimitiveArray<arrow::FloatType, float>(reader, rows, all_rows);
+  case CDataType_DOUBLE:
+    return BuildPrimitiveArray<arrow::DoubleType, double>(reader, rows, all_rows);
+  case CDataType_DATE: {
+    arrow::Date32Builder builder;
+    return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t) {
+      DATE_STRUCT date;
+      std::memcpy(&date, value, sizeof(date));
+      builder.UnsafeAppend(static_cast<int32_t>(GetDays(date.year, date.month, date.day)));
+      return arrow::Status::OK();
+    });
+  }
+  case CDataType_TIME: {
+    arrow::Time64Builder builder(arrow::time64(arrow::TimeUnit::MICRO),
+                                 arrow::default_memory_pool());
+    return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t) {
+      TIME_STRUCT time;
+      std::memcpy(&time, value, sizeof(time));
+      builder.UnsafeAppend(GetSecondsOfDay(time.hour, time.minute, time.second) *
+                           MICRO_TO_SECONDS_DIVISOR);
+      return arrow::Status::OK();
+    });
+  }
+  case CDataType_TIMESTAMP:
+    return BuildTimestampArray(reader, rows, target);
+  case CDataType_NUMERIC:
+    return BuildNumericArray(reader, rows, target);
+  case CDataType_GUID: {
+    arrow::FixedSizeBinaryBuilder builder(arrow::fixed_size_binary(sizeof(SQLGUID)));
+    return BuildArray(builder, reader, rows, [&](const uint8_t *value, size_t) {
+      SQLGUID guid;
+      std::memcpy(&guid, value, sizeof(guid));
+      // Arrow UUIDs hold the 16 bytes in big-endian order.
+      uint8_t bytes[sizeof(SQLGUID)];
+      const uint32_t data1 = arrow::bit_util::ToBigEndian(static_cast<uint32_t>(guid.Data1));
+      const uint16_t data2 = arrow::bit_util::ToBigEndian(static_cast<uint16_t>(guid.Data2));
+      const uint16_t data3 = arrow::bit_util::ToBigEndian(static_cast<uint16_t>(guid.Data3));
+      std::memcpy(bytes, &data1, sizeof(data1));
+      std::memcpy(bytes + 4, &data2, sizeof(data2));
+      std::memcpy(bytes + 6, &data3, sizeof(data3));
+      std::memcpy(bytes + 8, guid.Data4, sizeof(guid.Data4));
+      builder.UnsafeAppend(bytes);
+      return arrow::Status::OK();
+    });
+  }
+  default:
+    throw DriverException("Unsupported parameter C data type: " +
+                              std::to_string(reader.GetBinding().target_type),
+                          "HY003");
+  }
+}
+
+/// Arrow type used for a parameter the server did not describe.
+std::shared_ptr<DataType> GetDataTypeForSqlType(const ParameterBinding &binding) {
+  switch (binding.sql_type) {
+  case SQL_CHAR:
+  case SQL_VARCHAR:
+  case SQL_LONGVARCHAR:
+  case SQL_WCHAR:
+  case SQL_WVARCHAR:
+  case SQL_WLONGVARCHAR:
+    return arrow::utf8();
+  case SQL_BIT:
+    return arrow::boolean();
+  case SQL_TINYINT:
+    return arrow::int8();
+  case SQL_SMALLINT:
+    return arrow::int16();
+  case SQL_INTEGER:
+    return arrow::int32();
+  case SQL_BIGINT:
+    return arrow::int64();
+  case SQL_REAL:
+    return arrow::float32();
+  case SQL_FLOAT:
+  case SQL_DOUBLE:
+    return arrow::float64();
+  case SQL_DECIMAL:
+  case SQL_NUMERIC: {
+    const int32_t precision = binding.precision > 0 && binding.precision <= MAX_DECIMAL_PRECISION
+                                  ? binding.precision
+                                  : MAX_DECIMAL_PRECISION;
+    return arrow::decimal128(precision, std::clamp(binding.scale, 0, precision));
+  }
+  case SQL_BINARY:
+  case SQL_VARBINARY:
+  case SQL_LONGVARBINARY:
+    return arrow::binary();
+  case SQL_DATE:
+  case SQL_TYPE_DATE:
+    return arrow::date32();
+  case SQL_TIME:
+  case SQL_TYPE_TIME:
+    return arrow::time64(arrow::TimeUnit::MICRO);
+  case SQL_TIMESTAMP:
+  case SQL_TYPE_TIMESTAMP:
+    return arrow::timestamp(arrow::TimeUnit::MICRO);
+  case SQL_GUID:
+    return arrow::fixed_size_binary(sizeof(SQLGUID));
+  default:
+    return nullptr;
+  }
+}
+
+std::shared_ptr<Array> ConvertToType(const std::shared_ptr<Array> &array,
+                                     const std::shared_ptr<DataType> &type, size_t parameter) {
+  if (!type || array->type()->Equals(*type)) {
+    return array;
+  }
+  if (type->id() == arrow::Type::EXTENSION) {
+    const auto &extension_type = arrow::internal::checked_cast<const arrow::ExtensionType &>(*type);
+    return arrow::ExtensionType::WrapArray(
+        type, ConvertToType(array, extension_type.storage_type(), parameter));
+  }
+
+  // Arrow 23 requires explicit initialization of compute kernels (strptime, add, cast, etc.)
+  static auto compute_init = arrow::compute::Initialize();
+  ThrowIfNotOK(compute_init);
+
+  auto result = arrow::compute::Cast(*array, type);
+  if (!result.ok()) {
+    throw DriverException("Cannot convert parameter " + std::to_string(parameter) + " to " +
+                              type->ToString() + ": " + result.status().message(),
+                          result.status().IsNotImplemented() ? "07006" : "22018");
+  }
+  return *result;
+}
+
+} // namespace
+
+std::shared_ptr<arrow::RecordBatch>
+BuildParameterBatch(const std::vector<ParameterBinding> &bindings,
+                    const std::shared_ptr<arrow::Schema> &parameter_schema,
+                    size_t paramset_size, size_t bind_offset, size_t bind_type,
+                    const uint16_t *operation_array) {
+  // Trust the server's parameter count when it reports one; extra bindings
+  // are ignored, as ODBC requires.
+  const size_t described_count = parameter_schema ? parameter_schema->num_fields() : 0;
+  const size_t parameter_count = described_count > 0 ? described_count : bindings.size();
+
+  std::vector<size_t> rows;
+  rows.reserve(paramset_size);
+  for (size_t row = 0; row < paramset_size; ++row) {
+    if (!operation_array || operation_array[row] != SQL_PARAM_IGNORE) {
+      rows.push_back(row);
+    }
+  }
+  const bool all_rows = rows.size() == paramset_size;
+
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  fields.reserve(parameter_count);
+  columns.reserve(parameter_count);
+
+  for (size_t i = 0; i < parameter_count; ++i) {
+    if (i >= bindings.size() || !bindings[i].IsBound()) {
+      throw DriverException("COUNT field incorrect: parameter " + std::to_string(i + 1) +
+                                " is not bound",
+                            "07002");
+    }
+
+    std::shared_ptr<arrow::Field> described_field =
+        i < described_count ? parameter_schema->field(static_cast<int>(i)) : nullptr;
+    std::shared_ptr<DataType> type =
+        described_field && described_field->type()->id() != arrow::Type::NA
+            ? described_field->type()
+            : GetDataTypeForSqlType(bindings[i]);
+
+    ParameterReader reader(bindings[i], bind_offset, bind_type);
+    auto column = ConvertToType(BuildValues(reader, rows, all_rows, type), type, i + 1);
+
+    const std::string name =
+        described_field ? described_field->name() : "parameter_" + std::to_string(i + 1);
+    fields.push_back(arrow::field(name, column->type()));
+    columns.push_back(std::move(column));
+  }
+
+  return arrow::RecordBatch::Make(arrow::schema(fields), static_cast<int64_t>(rows.size()),
+                                  columns);
+}
+
+} // namespace flight_sql
+} // namespace driver
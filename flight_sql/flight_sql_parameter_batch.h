@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include "accessors/types.h"
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <memory>
+#include <vector>
+
+namespace driver {
+namespace flight_sql {
+
+/// \brief An application buffer bound to a parameter marker. Values and
+/// indicators are addressed like the cells of a bound result column, with
+/// precision and scale holding the column size and decimal digits declared
+/// for the parameter.
+struct ParameterBinding : ColumnBinding {
+  int16_t sql_type = 0;
+
+  ParameterBinding()
+      : ColumnBinding(odbcabstraction::CDataType_DEFAULT, 0, 0, nullptr, 0, nullptr) {}
+
+  ParameterBinding(CDataType c_type, int16_t sql_type, int precision, int scale,
+                   void *buffer, size_t buffer_length, ssize_t *strlen_buffer)
+      : ColumnBinding(c_type, precision, scale, buffer, buffer_length, strlen_buffer),
+        sql_type(sql_type) {}
+
+  inline bool IsBound() const { return buffer != nullptr || strlen_buffer != nullptr; }
+};
+
+/// \brief Converts bound parameter arrays into a single RecordBatch holding one
+/// row per parameter set, so every set is sent to the server in one call.
+///
+/// Each column takes the type the server reported in \p parameter_schema, or
+/// the type matching the declared SQL type when the server reported none.
+/// Parameter sets marked SQL_PARAM_IGNORE in \p operation_array are skipped.
+///
+/// \param bindings       The bound parameters, in parameter order.
+/// \param parameter_schema The parameter schema reported by the server, may
+///                       be null or empty.
+/// \param paramset_size  The number of parameter sets in the bound buffers.
+/// \param bind_offset    The offset for bound parameters and indicators.
+/// \param bind_type      Zero for column-wise binding, otherwise the size of
+///                       an application row buffer.
+/// \param operation_array Optional array marking parameter sets to skip.
+/// \return The RecordBatch to pass to PreparedStatement::SetParameters.
+std::shared_ptr<arrow::RecordBatch>
+BuildParameterBatch(const std::vector<ParameterBinding> &bindings,
+                    const std::shared_ptr<arrow::Schema> &parameter_schema,
+                    size_t paramset_size, size_t bind_offset, size_t bind_type,
+                    const uint16_t *operation_array);
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_parameter_batch.h"
+#include "gtest/gtest.h"
+#include <arrow/array.h>
+#include <odbcabstraction/platform.h>
+#include <sql.h>
+#include <sqlext.h>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using namespace odbcabstraction;
+
+TEST(ParameterBatch, ColumnWiseArrays) {
+  std::vector<int32_t> ids = {1, 2, 3};
+  std::vector<ssize_t> id_indicators = {0, SQL_NULL_DATA, 0};
+  char names[3][8] = {"ab", "cde", "x"};
+  std::vector<ssize_t> name_indicators = {SQL_NTS, 3, 1};
+
+  std::vector<ParameterBinding> bindings = {
+      ParameterBinding(CDataType_SLONG, SQL_BIGINT, 0, 0, ids.data(), 0, id_indicators.data()),
+      ParameterBinding(CDataType_CHAR, SQL_VARCHAR, 8, 0, names, sizeof(names[0]),
+                       name_indicators.data())};
+
+  auto batch = BuildParameterBatch(bindings, nullptr, 3, 0, 0, nullptr);
+
+  ASSERT_EQ(3, batch->num_rows());
+  ASSERT_EQ(2, batch->num_columns());
+  // Without a server schema the declared SQL type decides the column type.
+  ASSERT_TRUE(batch->column(0)->type()->Equals(int64()));
+  const auto &id_array = static_cast<const Int64Array &>(*batch->column(0));
+  ASSERT_EQ(1, id_array.Value(0));
+  ASSERT_TRUE(id_array.IsNull(1));
+  ASSERT_EQ(3, id_array.Value(2));
+
+  const auto &name_array = static_cast<const StringArray &>(*batch->column(1));
+  ASSERT_EQ("ab", name_array.GetView(0));
+  ASSERT_EQ("cde", name_array.GetView(1));
+  ASSERT_EQ("x", name_array.GetView(2));
+}
+
+TEST(ParameterBatch, RowWiseArraysFollowServerSchema) {
+  struct Row {
+    double price;
+    SQLLEN price_indicator;
+    DATE_STRUCT day;
+    SQLLEN day_indicator;
+  };
+  Row rows[3] = {{1.5, 0, {2024, 2, 29}, 0},
+                 {2.5, 0, {1969, 12, 31}, SQL_NULL_DATA},
+                 {3.5, 0, {1970, 1, 2}, 0}};
+  std::vector<uint16_t> operations = {SQL_PARAM_PROCEED, SQL_PARAM_IGNORE, SQL_PARAM_PROCEED};
+
+  std::vector<ParameterBinding> bindings = {
+      ParameterBinding(CDataType_DOUBLE, SQL_DOUBLE, 0, 0, &rows[0].price, 0,
+                       &rows[0].price_indicator),
+      ParameterBinding(CDataType_DATE, SQL_TYPE_DATE, 0, 0, &rows[0].day, 0,
+                       &rows[0].day_indicator)};
+  auto parameter_schema =
+      schema({field("price", float32()), field("day", date32())});
+
+  auto batch = BuildParameterBatch(bindings, parameter_schema, 3, 0, sizeof(Row),
+                                   operations.data());
+
+  // The ignored parameter set is left out of the batch.
+  ASSERT_EQ(2, batch->num_rows());
+  ASSERT_EQ("price", batch->schema()->field(0)->name());
+  ASSERT_TRUE(batch->column(0)->type()->Equals(float32()));
+  const auto &price_array = static_cast<const FloatArray &>(*batch->column(0));
+  ASSERT_EQ(1.5f, price_array.Value(0));
+  ASSERT_EQ(3.5f, price_array.Value(1));
+
+  const auto &day_array = static_cast<const Date32Array &>(*batch->column(1));
+  ASSERT_EQ(19782, day_array.Value(0));
+  ASSERT_EQ(1, day_array.Value(1));
+}
+
+TEST(ParameterBatch, NumericTimestampAndErrors) {
+  SQL_NUMERIC_STRUCT numeric{};
+  numeric.precision = 10;
+  numeric.scale = 2;
+  numeric.sign = 0;
+  numeric.val[0] = 0xD2; // 1234
+  numeric.val[1] = 0x04;
+  TIMESTAMP_STRUCT timestamp{1970, 1, 1, 0, 0, 1, 500000000};
+
+  std::vector<ParameterBinding> bindings = {
+      ParameterBinding(CDataType_NUMERIC, SQL_DECIMAL, 10, 2, &numeric, 0, nullptr),
+      ParameterBinding(CDataType_TIMESTAMP, SQL_TYPE_TIMESTAMP, 0, 0, &timestamp, 0, nullptr)};
+
+  auto batch = BuildParameterBatch(bindings, nullptr, 1, 0, 0, nullptr);
+  ASSERT_EQ("-12.34", static_cast<const Decimal128Array &>(*batch->column(0)).FormatValue(0));
+  ASSERT_EQ(1500000, static_cast<const TimestampArray &>(*batch->column(1)).Value(0));
+
+  // Every parameter the server describes must be bound.
+  auto parameter_schema = schema({field("a", decimal128(10, 2)), field("b", timestamp(TimeUnit::MICRO)),
+                                  field("c", int32())});
+  ASSERT_THROW(BuildParameterBatch(bindings, parameter_schema, 1, 0, 0, nullptr), DriverException);
+
+  char text[] = "not a number";
+  std::vector<ParameterBinding> text_binding = {
+      ParameterBinding(CDataType_CHAR, SQL_INTEGER, 0, 0, text, sizeof(text), nullptr)};
+  ASSERT_THROW(BuildParameterBatch(text_binding, nullptr, 1, 0, 0, nullptr), DriverException);
+}
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_prepared_statement_cache.h"
+
+#include <cctype>
+
+namespace driver {
+namespace flight_sql {
+
+namespace {
+
+bool IsSpace(char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; }
+
+/// Whether the query may hold text whose whitespace matters: string literals,
+/// quoted identifiers, dollar-quoted strings or comments.
+bool HasQuotedTextOrComments(const std::string &query) {
+  return query.find_first_of("'\"`$") != std::string::npos ||
+         query.find("--") != std::string::npos || query.find("/*") != std::string::npos;
+}
+
+} // namespace
+
+std::string NormalizeSqlForCache(const std::string &query) {
+  size_t begin = 0;
+  size_t end = query.size();
+  while (begin < end && IsSpace(query[begin])) {
+    ++begin;
+  }
+  while (end > begin && (IsSpace(query[end - 1]) || query[end - 1] == ';')) {
+    --end;
+  }
+
+  if (HasQuotedTextOrComments(query)) {
+    return query.substr(begin, end - begin);
+  }
+
+  std::string key;
+  key.reserve(end - begin);
+  for (size_t i = begin; i < end; ++i) {
+    if (!IsSpace(query[i])) {
+      key.push_back(query[i]);
+    } else if (key.back() != ' ') {
+      key.push_back(' ');
+    }
+  }
+  return key;
+}
+
+void ClosePreparedStatements(
+    const std::vector<std::shared_ptr<arrow::flight::sql::PreparedStatement>> &prepared_statements,
+    const arrow::flight::FlightCallOptions &call_options) {
+  for (const auto &prepared_statement : prepared_statements) {
+    auto status = prepared_statement->Close(call_options);
+    (void)status;
+  }
+}
+
+} // namespace flight_sql
+} // namespace driver
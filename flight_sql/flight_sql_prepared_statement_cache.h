@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include <arrow/flight/api.h>
+#include <arrow/flight/sql/api.h>
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace driver {
+namespace flight_sql {
+
+/// Builds the key a prepared query is cached under. Surrounding whitespace and
+/// trailing semicolons are dropped. Runs of whitespace are collapsed only when
+/// the query has no quoted text or comments, where they could be significant.
+std::string NormalizeSqlForCache(const std::string &query);
+
+/// Least recently used cache of idle server handles. A handle is checked out
+/// with `Acquire` and given back with `Release`, so no two users share it.
+template <typename Handle>
+class LruHandleCache {
+public:
+  explicit LruHandleCache(size_t capacity) : capacity_(capacity) {}
+
+  /// Number of times the cache was cleared. Users read it before acquiring or
+  /// creating a handle and pass it back to `Release`.
+  uint64_t generation() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return generation_;
+  }
+
+  /// Takes the handle cached under `key` out of the cache. Returns an empty
+  /// handle on a miss.
+  Handle Acquire(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return Handle();
+    }
+
+    Handle handle = std::move(it->second->second);
+    entries_.erase(it->second);
+    index_.erase(it);
+    return handle;
+  }
+
+  /// Caches `handle` under `key` as the most recently used entry, unless the
+  /// cache was cleared since `generation` was read while the handle was out.
+  /// \return the handles that no longer fit, which the caller must close.
+  std::vector<Handle> Release(const std::string &key, Handle handle, uint64_t generation) {
+    std::vector<Handle> evicted;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_ || capacity_ == 0 || generation != generation_) {
+      evicted.push_back(std::move(handle));
+      return evicted;
+    }
+
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      evicted.push_back(std::move(it->second->second));
+      entries_.erase(it->second);
+      index_.erase(it);
+    }
+
+    entries_.emplace_front(key, std::move(handle));
+    index_.emplace(key, entries_.begin());
+    while (entries_.size() > capacity_) {
+      evicted.push_back(std::move(entries_.back().second));
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+    return evicted;
+  }
+
+  /// Empties the cache, which keeps caching the handles acquired afterwards.
+  /// Handles checked out now are closed when they are released.
+  /// \return the cached handles, which the caller must close.
+  std::vector<Handle> Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    return TakeEntries();
+  }
+
+  /// Empties the cache. Handles released afterwards are not cached.
+  /// \return the cached handles, which the caller must close.
+  std::vector<Handle> Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    return TakeEntries();
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+private:
+  typedef std::list<std::pair<std::string, Handle>> Entries;
+
+  /// Removes every entry. Requires mutex_.
+  std::vector<Handle> TakeEntries() {
+    std::vector<Handle> evicted;
+    for (auto &entry : entries_) {
+      evicted.push_back(std::move(entry.second));
+    }
+    entries_.clear();
+    index_.clear();
+    return evicted;
+  }
+
+  mutable std::mutex mutex_;
+  const size_t capacity_;
+  bool closed_ = false;
+  uint64_t generation_ = 0;
+  // Most recently used first.
+  Entries entries_;
+  std::unordered_map<std::string, typename Entries::iterator> index_;
+};
+
+typedef LruHandleCache<std::shared_ptr<arrow::flight::sql::PreparedStatement>>
+    PreparedStatementCache;
+
+/// Closes server prepared statements on a best-effort basis; the server drops
+/// the ones that fail when the session ends.
+void ClosePreparedStatements(
+    const std::vector<std::shared_ptr<arrow::flight::sql::PreparedStatement>> &prepared_statements,
+    const arrow::flight::FlightCallOptions &call_options);
+
+} // namespace flight_sql
+} // namespace driver
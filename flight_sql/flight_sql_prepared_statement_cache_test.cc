@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_prepared_statement_cache.h"
+#include "gtest/gtest.h"
+
+namespace driver {
+namespace flight_sql {
+
+typedef LruHandleCache<std::shared_ptr<int>> IntCache;
+
+TEST(PreparedStatementCache, NormalizesUnquotedWhitespace) {
+  ASSERT_EQ("SELECT a FROM t WHERE b = ?",
+            NormalizeSqlForCache("  SELECT a\n  FROM t\tWHERE b = ? ;\n"));
+  ASSERT_EQ("SELECT 1", NormalizeSqlForCache("SELECT 1;;"));
+}
+
+TEST(PreparedStatementCache, KeepsQuotedTextVerbatim) {
+  ASSERT_EQ("SELECT 'a  b'", NormalizeSqlForCache(" SELECT 'a  b' "));
+  ASSERT_EQ("SELECT 1 -- note\n  FROM t", NormalizeSqlForCache("SELECT 1 -- note\n  FROM t"));
+  ASSERT_NE(NormalizeSqlForCache("SELECT \"a  b\""), NormalizeSqlForCache("SELECT \"a b\""));
+}
+
+TEST(PreparedStatementCache, ReusesReleasedHandles) {
+  IntCache cache(2);
+  auto handle = std::make_shared<int>(1);
+
+  ASSERT_EQ(nullptr, cache.Acquire("q"));
+  ASSERT_TRUE(cache.Release("q", handle, cache.generation()).empty());
+
+  // A checked out handle is not handed out twice.
+  ASSERT_EQ(handle, cache.Acquire("q"));
+  ASSERT_EQ(nullptr, cache.Acquire("q"));
+}
+
+TEST(PreparedStatementCache, EvictsLeastRecentlyUsed) {
+  IntCache cache(2);
+  auto first = std::make_shared<int>(1);
+  auto second = std::make_shared<int>(2);
+  auto third = std::make_shared<int>(3);
+
+  cache.Release("q1", first, cache.generation());
+  cache.Release("q2", second, cache.generation());
+  cache.Release("q1", cache.Acquire("q1"), cache.generation());
+
+  ASSERT_EQ(std::vector<std::shared_ptr<int>>({second}),
+            cache.Release("q3", third, cache.generation()));
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(first, cache.Acquire("q1"));
+  ASSERT_EQ(third, cache.Acquire("q3"));
+}
+
+TEST(PreparedStatementCache, ReplacesDuplicateHandles) {
+  IntCache cache(2);
+  auto older = std::make_shared<int>(1);
+  auto newer = std::make_shared<int>(2);
+
+  cache.Release("q", older, cache.generation());
+  ASSERT_EQ(std::vector<std::shared_ptr<int>>({older}),
+            cache.Release("q", newer, cache.generation()));
+  ASSERT_EQ(newer, cache.Acquire("q"));
+}
+
+TEST(PreparedStatementCache, ClearedCacheKeepsCaching) {
+  auto first = std::make_shared<int>(1);
+  auto second = std::make_shared<int>(2);
+
+  IntCache cache(2);
+  cache.Release("q1", first, cache.generation());
+  ASSERT_EQ(std::vector<std::shared_ptr<int>>({first}), cache.Clear());
+  ASSERT_EQ(nullptr, cache.Acquire("q1"));
+
+  ASSERT_TRUE(cache.Release("q2", second, cache.generation()).empty());
+  ASSERT_EQ(second, cache.Acquire("q2"));
+}
+
+TEST(PreparedStatementCache, DropsHandlesAcquiredBeforeClear) {
+  auto handle = std::make_shared<int>(1);
+
+  IntCache cache(2);
+  const uint64_t generation = cache.generation();
+  ASSERT_EQ(nullptr, cache.Acquire("q"));
+  cache.Clear();
+
+  // The handle was checked out when the cache was cleared, so it is closed.
+  ASSERT_EQ(std::vector<std::shared_ptr<int>>({handle}), cache.Release("q", handle, generation));
+  ASSERT_EQ(0, cache.size());
+}
+
+TEST(PreparedStatementCache, ClosedOrDisabledCacheKeepsNothing) {
+  auto handle = std::make_shared<int>(1);
+
+  IntCache disabled(0);
+  ASSERT_EQ(std::vector<std::shared_ptr<int>>({handle}),
+            disabled.Release("q", handle, disabled.generation()));
+
+  IntCache cache(2);
+  cache.Release("q", handle, cache.generation());
+  ASSERT_EQ(std::vector<std::shared_ptr<int>>({handle}), cache.Close());
+  ASSERT_EQ(std::vector<std::shared_ptr<int>>({handle}),
+            cache.Release("q", handle, cache.generation()));
+  ASSERT_EQ(0, cache.size());
+}
+
+} // namespace flight_sql
+} // namespace driver
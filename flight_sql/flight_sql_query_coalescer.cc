@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_query_coalescer.h"
+
+#include <odbcabstraction/exceptions.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace driver {
+namespace flight_sql {
+
+using arrow::RecordBatch;
+using odbcabstraction::DriverException;
+
+CoalescedQuery::Reader::~Reader() { query_->RemoveReader(this); }
+
+bool CoalescedQuery::Reader::Next(std::shared_ptr<RecordBatch> *batch) {
+  CoalescedQuery &query = *query_;
+  std::unique_lock<std::mutex> lock(query.mutex_);
+  while (true) {
+    if (interrupted_) {
+      throw DriverException("Operation canceled", "HY008");
+    }
+    if (detached_) {
+      throw DriverException("The statement fell too far behind the other statements sharing "
+                            "the execution of its query. Execute it again.", "HY000");
+    }
+    if (position_ < query.first_batch_ + query.batches_.size()) {
+      *batch = query.batches_[position_ - query.first_batch_];
+      ++position_;
+      query.DropReadBatches();
+      return true;
+    }
+    if (query.error_) {
+      std::rethrow_exception(query.error_);
+    }
+    if (query.finished_) {
+      return false;
+    }
+    if (query.reading_) {
+      query.changed_.wait(lock);
+      continue;
+    }
+
+    // This reader is the furthest ahead, so it reads the next batch for all.
+    query.reading_ = true;
+    lock.unlock();
+    std::shared_ptr<RecordBatch> next;
+    std::exception_ptr error;
+    bool has_next = false;
+    try {
+      has_next = query.source_(&next);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+    query.reading_ = false;
+    if (error) {
+      query.error_ = error;
+    } else if (has_next) {
+      query.batches_.push_back(std::move(next));
+      query.DetachLaggingReaders();
+    } else {
+      query.finished_ = true;
+    }
+    query.changed_.notify_all();
+  }
+}
+
+bool CoalescedQuery::Reader::WaitUntilStarted() {
+  CoalescedQuery &query = *query_;
+  std::unique_lock<std::mutex> lock(query.mutex_);
+  query.changed_.wait(lock, [&] { return query.state_ != PENDING || interrupted_; });
+  if (interrupted_) {
+    throw DriverException("Operation canceled", "HY008");
+  }
+  return query.state_ == STARTED;
+}
+
+void CoalescedQuery::Reader::Interrupt() {
+  CoalescedQuery &query = *query_;
+  std::unique_lock<std::mutex> lock(query.mutex_);
+  interrupted_ = true;
+  query.StopIfUnread();
+  query.changed_.notify_all();
+}
+
+void CoalescedQuery::Start(std::shared_ptr<arrow::Schema> schema, int64_t total_records,
+                           size_t buffer_capacity, RecordBatchSource source) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  schema_ = std::move(schema);
+  total_records_ = total_records;
+  buffer_capacity_ = std::max<size_t>(buffer_capacity, 1);
+  source_ = std::move(source);
+  state_ = STARTED;
+  changed_.notify_all();
+}
+
+void CoalescedQuery::Fail() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  state_ = FAILED;
+  changed_.notify_all();
+}
+
+std::shared_ptr<CoalescedQuery::Reader> CoalescedQuery::AddReader() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  // Late readers would miss the batches already dropped.
+  if (state_ == FAILED || first_batch_ > 0 || finished_ || error_ ||
+      stop_source_.token().IsStopRequested()) {
+    return nullptr;
+  }
+
+  auto reader = std::make_shared<Reader>(shared_from_this());
+  readers_.push_back(reader.get());
+  return reader;
+}
+
+void CoalescedQuery::RemoveReader(const Reader *reader) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  // Detached readers were removed already.
+  auto it = std::find(readers_.begin(), readers_.end(), reader);
+  if (it != readers_.end()) {
+    readers_.erase(it);
+  }
+  DropReadBatches();
+  StopIfUnread();
+}
+
+void CoalescedQuery::StopIfUnread() {
+  if (std::all_of(readers_.begin(), readers_.end(),
+                  [](const Reader *reader) { return reader->interrupted_; })) {
+    stop_source_.RequestStop();
+  }
+}
+
+void CoalescedQuery::DropReadBatches() {
+  if (readers_.empty()) {
+    return;
+  }
+
+  size_t slowest = (*std::min_element(readers_.begin(), readers_.end(),
+                                      [](const Reader *a, const Reader *b) {
+                                        return a->position_ < b->position_;
+                                      }))->position_;
+  while (first_batch_ < slowest) {
+    batches_.pop_front();
+    ++first_batch_;
+  }
+}
+
+void CoalescedQuery::DetachLaggingReaders() {
+  // The reader that read the newest batch is never at the oldest one, since
+  // more than one batch is kept here.
+  while (batches_.size() > buffer_capacity_ && !readers_.empty()) {
+    for (auto it = readers_.begin(); it != readers_.end();) {
+      if ((*it)->position_ == first_batch_) {
+        (*it)->detached_ = true;
+        it = readers_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    DropReadBatches();
+  }
+}
+
+std::shared_ptr<CoalescedQuery::Reader> QueryCoalescer::Join(const std::string &key,
+                                                             bool *leader) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (auto it = queries_.begin(); it != queries_.end();) {
+    it = it->second.expired() ? queries_.erase(it) : std::next(it);
+  }
+
+  auto it = queries_.find(key);
+  if (it != queries_.end()) {
+    if (auto query = it->second.lock()) {
+      if (auto reader = query->AddReader()) {
+        *leader = false;
+        return reader;
+      }
+    }
+  }
+
+  auto query = std::make_shared<CoalescedQuery>();
+  queries_[key] = query;
+  *leader = true;
+  return query->AddReader();
+}
+
+void QueryCoalescer::Clear() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  queries_.clear();
+}
+
+} // namespace flight_sql
+} // namespace driver
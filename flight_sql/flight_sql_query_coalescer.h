@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include "flight_sql_stream_chunk_buffer.h"
+
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <arrow/util/cancel.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace driver {
+namespace flight_sql {
+
+/// One server execution of a query, whose batches are handed to every
+/// statement that executed the same query while it was in flight. Batches are
+/// kept until every reader got past them, up to a bound past which the readers
+/// falling behind are detached.
+class CoalescedQuery : public std::enable_shared_from_this<CoalescedQuery> {
+public:
+  /// Reads the batches of the query from the first one on.
+  class Reader {
+  public:
+    explicit Reader(std::shared_ptr<CoalescedQuery> query) : query_(std::move(query)) {}
+
+    ~Reader();
+
+    const std::shared_ptr<CoalescedQuery> &query() const { return query_; }
+
+    /// \return false once every batch was returned.
+    /// Throws HY008 once the reader was interrupted, and HY000 once it was
+    /// detached for falling behind.
+    bool Next(std::shared_ptr<arrow::RecordBatch> *batch);
+
+    /// Waits until the execution started or failed.
+    /// \return whether it started. Throws HY008 once the reader was interrupted.
+    bool WaitUntilStarted();
+
+    /// Makes the waits of the reader throw HY008, for the statement reading
+    /// it was interrupted. The execution stops once every reader was
+    /// interrupted or went away.
+    void Interrupt();
+
+  private:
+    friend class CoalescedQuery;
+
+    std::shared_ptr<CoalescedQuery> query_;
+    // Position of the next batch to return.
+    size_t position_ = 0;
+    bool interrupted_ = false;
+    // The batches the reader needs were dropped.
+    bool detached_ = false;
+  };
+
+  /// Publishes the results of the execution to the readers. Batches are read
+  /// from `source` as the readers need them, by one reader at a time. Once
+  /// more than `buffer_capacity` batches are kept, the readers at the oldest
+  /// one are detached.
+  void Start(std::shared_ptr<arrow::Schema> schema, int64_t total_records,
+             size_t buffer_capacity, RecordBatchSource source);
+
+  /// Reports that the execution failed, so the readers waiting for it execute
+  /// the query by themselves.
+  void Fail();
+
+  /// Token the calls streaming the results must stop on, which fires once no
+  /// reader is left to read them.
+  arrow::StopToken stop_token() { return stop_source_.token(); }
+
+  const std::shared_ptr<arrow::Schema> &schema() const { return schema_; }
+
+  int64_t total_records() const { return total_records_; }
+
+private:
+  friend class QueryCoalescer;
+
+  enum State { PENDING, STARTED, FAILED };
+
+  /// Adds a reader, unless the execution failed or dropped batches already.
+  std::shared_ptr<Reader> AddReader();
+
+  void RemoveReader(const Reader *reader);
+
+  /// Drops the batches every reader got past. Requires mutex_.
+  void DropReadBatches();
+
+  /// Detaches the readers at the oldest batch until no more than
+  /// buffer_capacity_ batches are kept. Requires mutex_.
+  void DetachLaggingReaders();
+
+  /// Stops the execution when every reader was interrupted or went away.
+  /// Requires mutex_.
+  void StopIfUnread();
+
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  State state_ = PENDING;
+  std::shared_ptr<arrow::Schema> schema_;
+  int64_t total_records_ = -1;
+  size_t buffer_capacity_ = 1;
+  RecordBatchSource source_;
+  // Whether a reader is reading from source_.
+  bool reading_ = false;
+  bool finished_ = false;
+  std::exception_ptr error_;
+  // Batches not every reader got past yet, starting at position first_batch_.
+  std::deque<std::shared_ptr<arrow::RecordBatch>> batches_;
+  size_t first_batch_ = 0;
+  std::vector<Reader *> readers_;
+  arrow::StopSource stop_source_;
+};
+
+/// Matches statements executing the same query on a connection while it is in
+/// flight, so they share one server execution.
+class QueryCoalescer {
+public:
+  /// Joins the execution of the query identified by `key`, or starts a new one
+  /// when none can be joined.
+  /// \param leader[out] whether the caller must execute the query, and
+  /// then start or fail the execution.
+  std::shared_ptr<CoalescedQuery::Reader> Join(const std::string &key, bool *leader);
+
+  /// Keeps statements executed from now on from joining the executions in
+  /// flight, which keep serving their readers.
+  void Clear();
+
+private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::weak_ptr<CoalescedQuery>> queries_;
+};
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_query_coalescer.h"
+#include "gtest/gtest.h"
+#include <arrow/array.h>
+#include <arrow/builder.h>
+#include <odbcabstraction/exceptions.h>
+
+#include <future>
+#include <thread>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+using odbcabstraction::DriverException;
+
+namespace {
+
+std::shared_ptr<Schema> IdSchema() { return schema({field("id", int32())}); }
+
+/// Produces `count` batches holding their position, counting the batches read.
+RecordBatchSource MakeSource(int32_t count, int *reads) {
+  return [count, reads, next = 0](std::shared_ptr<RecordBatch> *batch) mutable {
+    if (next == count) {
+      return false;
+    }
+    Int32Builder builder;
+    EXPECT_TRUE(builder.Append(next++).ok());
+    std::shared_ptr<Array> array;
+    EXPECT_TRUE(builder.Finish(&array).ok());
+    *batch = RecordBatch::Make(IdSchema(), 1, {array});
+    ++*reads;
+    return true;
+  };
+}
+
+std::vector<int32_t> ReadAll(CoalescedQuery::Reader &reader) {
+  std::vector<int32_t> ids;
+  std::shared_ptr<RecordBatch> batch;
+  while (reader.Next(&batch)) {
+    ids.push_back(static_cast<const Int32Array &>(*batch->column(0)).Value(0));
+  }
+  return ids;
+}
+
+} // namespace
+
+TEST(QueryCoalescer, SharesOneExecution) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+  ASSERT_TRUE(leader);
+  auto second = coalescer.Join("q", &leader);
+  ASSERT_FALSE(leader);
+  ASSERT_EQ(first->query(), second->query());
+
+  int reads = 0;
+  first->query()->Start(IdSchema(), 3, 4, MakeSource(3, &reads));
+  ASSERT_TRUE(second->WaitUntilStarted());
+
+  std::vector<int32_t> second_ids;
+  std::thread thread([&] { second_ids = ReadAll(*second); });
+  ASSERT_EQ(std::vector<int32_t>({0, 1, 2}), ReadAll(*first));
+  thread.join();
+  ASSERT_EQ(std::vector<int32_t>({0, 1, 2}), second_ids);
+  ASSERT_EQ(3, reads);
+}
+
+TEST(QueryCoalescer, StartsAnotherExecutionOnceBatchesWereDropped) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+  int reads = 0;
+  first->query()->Start(IdSchema(), 3, 4, MakeSource(3, &reads));
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_TRUE(first->Next(&batch));
+  auto second = coalescer.Join("q", &leader);
+  ASSERT_TRUE(leader);
+  ASSERT_NE(first->query(), second->query());
+}
+
+TEST(QueryCoalescer, WaitingStatementsExecuteAloneAfterFailure) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+  auto second = coalescer.Join("q", &leader);
+
+  first->query()->Fail();
+  ASSERT_FALSE(second->WaitUntilStarted());
+  coalescer.Join("q", &leader);
+  ASSERT_TRUE(leader);
+}
+
+TEST(QueryCoalescer, ReportsStreamErrorsToEveryReader) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+  auto second = coalescer.Join("q", &leader);
+  first->query()->Start(IdSchema(), 0, 4, [](std::shared_ptr<RecordBatch> *) -> bool {
+    throw DriverException("stream failed");
+  });
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_THROW(first->Next(&batch), DriverException);
+  ASSERT_THROW(second->Next(&batch), DriverException);
+}
+
+TEST(QueryCoalescer, DetachesStalledReaders) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+  auto stalled = coalescer.Join("q", &leader);
+  int reads = 0;
+  first->query()->Start(IdSchema(), 5, 2, MakeSource(5, &reads));
+
+  // The reader that never reads is detached once it holds back more than two
+  // batches, so the other one reads the whole result.
+  ASSERT_EQ(std::vector<int32_t>({0, 1, 2, 3, 4}), ReadAll(*first));
+  try {
+    std::shared_ptr<RecordBatch> batch;
+    stalled->Next(&batch);
+    FAIL() << "A detached reader kept reading";
+  } catch (const DriverException &e) {
+    ASSERT_EQ("HY000", e.GetSqlState());
+  }
+}
+
+TEST(QueryCoalescer, InterruptStopsWaitingForTheExecution) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+  auto second = coalescer.Join("q", &leader);
+
+  auto waiting = std::async(std::launch::async, [&] { return second->WaitUntilStarted(); });
+  second->Interrupt();
+  try {
+    waiting.get();
+    FAIL() << "WaitUntilStarted returned after the reader was interrupted";
+  } catch (const DriverException &e) {
+    ASSERT_EQ("HY008", e.GetSqlState());
+  }
+}
+
+TEST(QueryCoalescer, InterruptStopsWaitingForAnotherReaderToRead) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+  auto second = coalescer.Join("q", &leader);
+  std::promise<void> reading;
+  std::promise<void> release;
+  first->query()->Start(IdSchema(), 0, 4, [&](std::shared_ptr<RecordBatch> *) {
+    reading.set_value();
+    release.get_future().wait();
+    return false;
+  });
+
+  std::shared_ptr<RecordBatch> batch;
+  auto first_read = std::async(std::launch::async, [&] { return first->Next(&batch); });
+  reading.get_future().wait();
+  std::shared_ptr<RecordBatch> second_batch;
+  auto second_read = std::async(std::launch::async, [&] { return second->Next(&second_batch); });
+  second->Interrupt();
+  ASSERT_THROW(second_read.get(), DriverException);
+
+  release.set_value();
+  ASSERT_FALSE(first_read.get());
+}
+
+TEST(QueryCoalescer, StopsTheExecutionOnceNoReaderIsLeft) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+  auto second = coalescer.Join("q", &leader);
+  auto query = first->query();
+
+  first->Interrupt();
+  ASSERT_FALSE(query->stop_token().IsStopRequested());
+  second.reset();
+  ASSERT_TRUE(query->stop_token().IsStopRequested());
+
+  // A stopped execution cannot be joined anymore.
+  auto third = coalescer.Join("q", &leader);
+  ASSERT_TRUE(leader);
+}
+
+TEST(QueryCoalescer, ClearKeepsLaterStatementsFromJoining) {
+  QueryCoalescer coalescer;
+  bool leader = false;
+  auto first = coalescer.Join("q", &leader);
+
+  coalescer.Clear();
+  auto second = coalescer.Join("q", &leader);
+  ASSERT_TRUE(leader);
+  ASSERT_NE(first->query(), second->query());
+}
+
+} // namespace flight_sql
+} // namespace driver
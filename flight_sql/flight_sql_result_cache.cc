@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_result_cache.h"
+
+#include <arrow/io/memory.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/util/byte_size.h>
+#include <arrow/util/compression.h>
+
+#include <iterator>
+#include <utility>
+
+namespace driver {
+namespace flight_sql {
+
+using arrow::RecordBatch;
+using arrow::Result;
+using arrow::Schema;
+
+namespace {
+
+size_t BatchSize(const RecordBatch &batch) {
+  return static_cast<size_t>(arrow::util::TotalBufferSize(batch));
+}
+
+} // namespace
+
+Result<std::shared_ptr<CachedResult>>
+CachedResult::Make(const std::shared_ptr<Schema> &schema, int64_t total_records,
+                   std::vector<std::shared_ptr<RecordBatch>> batches, bool compress) {
+  auto result = std::make_shared<CachedResult>();
+  result->schema_ = schema;
+  result->total_records_ = total_records;
+
+  if (compress && arrow::util::Codec::IsAvailable(arrow::Compression::LZ4_FRAME)) {
+    auto options = arrow::ipc::IpcWriteOptions::Defaults();
+    ARROW_ASSIGN_OR_RAISE(options.codec,
+                          arrow::util::Codec::Create(arrow::Compression::LZ4_FRAME));
+    ARROW_ASSIGN_OR_RAISE(auto stream, arrow::io::BufferOutputStream::Create());
+    ARROW_ASSIGN_OR_RAISE(auto writer, arrow::ipc::MakeStreamWriter(stream, schema, options));
+    for (const auto &batch : batches) {
+      ARROW_RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ARROW_RETURN_NOT_OK(writer->Close());
+    ARROW_ASSIGN_OR_RAISE(result->compressed_, stream->Finish());
+    result->size_ = static_cast<size_t>(result->compressed_->size());
+    return result;
+  }
+
+  for (const auto &batch : batches) {
+    result->size_ += BatchSize(*batch);
+  }
+  result->batches_ = std::move(batches);
+  return result;
+}
+
+Result<std::vector<std::shared_ptr<RecordBatch>>> CachedResult::GetBatches() const {
+  if (!compressed_) {
+    return batches_;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto reader, arrow::ipc::RecordBatchStreamReader::Open(
+                                         std::make_shared<arrow::io::BufferReader>(compressed_)));
+  return reader->ToRecordBatches();
+}
+
+QueryResultCache::QueryResultCache(std::chrono::milliseconds time_to_live, size_t max_bytes,
+                                   bool compress, std::function<Clock::time_point()> now)
+    : time_to_live_(time_to_live), max_bytes_(max_bytes), compress_(compress),
+      now_(std::move(now)) {}
+
+std::shared_ptr<CachedResult> QueryResultCache::Get(const std::string &key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it == index_.end() || it->second->expires_at <= now_()) {
+    if (it != index_.end()) {
+      Erase(it->second);
+    }
+    ++misses_;
+    return nullptr;
+  }
+
+  ++hits_;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->result;
+}
+
+void QueryResultCache::Put(const std::string &key, std::shared_ptr<CachedResult> result) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    Erase(it->second);
+  }
+  if (result->size() > max_bytes_) {
+    return;
+  }
+
+  bytes_ += result->size();
+  entries_.push_front(Entry{key, std::move(result), now_() + time_to_live_});
+  index_.emplace(key, entries_.begin());
+  while (bytes_ > max_bytes_) {
+    Erase(std::prev(entries_.end()));
+  }
+}
+
+void QueryResultCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  bytes_ = 0;
+}
+
+void QueryResultCache::Erase(Entries::iterator it) {
+  bytes_ -= it->result->size();
+  index_.erase(it->key);
+  entries_.erase(it);
+}
+
+ResultRecorder::ResultRecorder(std::shared_ptr<QueryResultCache> cache, std::string key,
+                               std::shared_ptr<Schema> schema, int64_t total_records)
+    : cache_(std::move(cache)), key_(std::move(key)), schema_(std::move(schema)),
+      total_records_(total_records) {}
+
+void ResultRecorder::Add(const std::shared_ptr<RecordBatch> &batch) {
+  if (done_) {
+    return;
+  }
+
+  // The batches are only compressed once the result completes, and may then
+  // fit a budget they exceed now.
+  bytes_ += BatchSize(*batch);
+  if (bytes_ > cache_->max_bytes() * (cache_->compress() ? 4 : 1)) {
+    done_ = true;
+    batches_.clear();
+    return;
+  }
+  batches_.push_back(batch);
+}
+
+void ResultRecorder::Finish() {
+  if (done_) {
+    return;
+  }
+  done_ = true;
+
+  auto result = CachedResult::Make(schema_, total_records_, std::move(batches_),
+                                   cache_->compress());
+  if (result.ok()) {
+    cache_->Put(key_, std::move(result).ValueOrDie());
+  }
+}
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include <arrow/buffer.h>
+#include <arrow/record_batch.h>
+#include <arrow/result.h>
+#include <arrow/type.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace driver {
+namespace flight_sql {
+
+/// The record batches of a complete query result, optionally held as an
+/// LZ4-compressed Arrow IPC stream.
+class CachedResult {
+public:
+  /// Compression is skipped when the Arrow library was built without LZ4.
+  static arrow::Result<std::shared_ptr<CachedResult>>
+  Make(const std::shared_ptr<arrow::Schema> &schema, int64_t total_records,
+       std::vector<std::shared_ptr<arrow::RecordBatch>> batches, bool compress);
+
+  const std::shared_ptr<arrow::Schema> &schema() const { return schema_; }
+
+  /// Row count the server reported when the query executed, -1 if unknown.
+  int64_t total_records() const { return total_records_; }
+
+  /// Returns the batches, decompressing them if needed.
+  arrow::Result<std::vector<std::shared_ptr<arrow::RecordBatch>>> GetBatches() const;
+
+  /// Memory held by the result, in bytes.
+  size_t size() const { return size_; }
+
+private:
+  std::shared_ptr<arrow::Schema> schema_;
+  int64_t total_records_ = -1;
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches_;
+  std::shared_ptr<arrow::Buffer> compressed_;
+  size_t size_ = 0;
+};
+
+/// Least recently used cache of query results, bounded by a byte budget.
+/// Results expire once they are older than the time to live.
+class QueryResultCache {
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  QueryResultCache(std::chrono::milliseconds time_to_live, size_t max_bytes, bool compress,
+                   std::function<Clock::time_point()> now = Clock::now);
+
+  /// Returns the result cached under `key`, or null when there is none or it
+  /// expired.
+  std::shared_ptr<CachedResult> Get(const std::string &key);
+
+  /// Caches `result` under `key`, evicting the least recently used results
+  /// that no longer fit. Results larger than the whole budget are not kept.
+  void Put(const std::string &key, std::shared_ptr<CachedResult> result);
+
+  /// Drops every cached result.
+  void Clear();
+
+  size_t max_bytes() const { return max_bytes_; }
+  bool compress() const { return compress_; }
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
+private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<CachedResult> result;
+    Clock::time_point expires_at;
+  };
+  typedef std::list<Entry> Entries;
+
+  void Erase(Entries::iterator it);
+
+  const std::chrono::milliseconds time_to_live_;
+  const size_t max_bytes_;
+  const bool compress_;
+  const std::function<Clock::time_point()> now_;
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+
+  std::mutex mutex_;
+  size_t bytes_ = 0;
+  // Most recently used first.
+  Entries entries_;
+  std::unordered_map<std::string, Entries::iterator> index_;
+};
+
+/// Collects the batches of a result as it streams, and caches them once the
+/// whole result was read. Results outgrowing the cache budget are abandoned.
+class ResultRecorder {
+public:
+  ResultRecorder(std::shared_ptr<QueryResultCache> cache, std::string key,
+                 std::shared_ptr<arrow::Schema> schema, int64_t total_records);
+
+  void Add(const std::shared_ptr<arrow::RecordBatch> &batch);
+
+  /// Caches the batches added so far as the complete result.
+  void Finish();
+
+private:
+  std::shared_ptr<QueryResultCache> cache_;
+  std::string key_;
+  std::shared_ptr<arrow::Schema> schema_;
+  int64_t total_records_;
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches_;
+  size_t bytes_ = 0;
+  bool done_ = false;
+};
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_result_cache.h"
+#include "gtest/gtest.h"
+#include <arrow/array.h>
+#include <arrow/builder.h>
+
+namespace driver {
+namespace flight_sql {
+
+using namespace arrow;
+
+namespace {
+
+std::shared_ptr<Schema> IdSchema() { return schema({field("id", int32())}); }
+
+std::shared_ptr<RecordBatch> MakeIds(int32_t first, int32_t count) {
+  Int32Builder builder;
+  for (int32_t i = 0; i < count; ++i) {
+    EXPECT_TRUE(builder.Append(first + i).ok());
+  }
+  std::shared_ptr<Array> array;
+  EXPECT_TRUE(builder.Finish(&array).ok());
+  return RecordBatch::Make(IdSchema(), count, {array});
+}
+
+std::shared_ptr<CachedResult> MakeResult(int32_t rows, bool compress = false) {
+  auto result = CachedResult::Make(IdSchema(), rows, {MakeIds(0, rows)}, compress);
+  EXPECT_TRUE(result.ok());
+  return result.ValueOrDie();
+}
+
+/// Clock the tests move forward by hand.
+struct FakeClock {
+  QueryResultCache::Clock::time_point now;
+
+  std::function<QueryResultCache::Clock::time_point()> Function() {
+    return [this] { return now; };
+  }
+};
+
+} // namespace
+
+TEST(QueryResultCache, CountsHitsAndMisses) {
+  QueryResultCache cache(std::chrono::seconds(60), 1 << 20, false);
+  auto result = MakeResult(10);
+
+  ASSERT_EQ(nullptr, cache.Get("q"));
+  cache.Put("q", result);
+  ASSERT_EQ(result, cache.Get("q"));
+  ASSERT_EQ(result, cache.Get("q"));
+
+  ASSERT_EQ(2, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+}
+
+TEST(QueryResultCache, ExpiresResultsAfterTimeToLive) {
+  FakeClock clock;
+  QueryResultCache cache(std::chrono::seconds(10), 1 << 20, false, clock.Function());
+  auto result = MakeResult(10);
+
+  cache.Put("q", result);
+  clock.now += std::chrono::seconds(9);
+  ASSERT_EQ(result, cache.Get("q"));
+  clock.now += std::chrono::seconds(1);
+  ASSERT_EQ(nullptr, cache.Get("q"));
+}
+
+TEST(QueryResultCache, EvictsLeastRecentlyUsedPastBudget) {
+  auto first = MakeResult(100);
+  auto second = MakeResult(100);
+  auto third = MakeResult(100);
+  QueryResultCache cache(std::chrono::seconds(60), 2 * first->size(), false);
+
+  cache.Put("q1", first);
+  cache.Put("q2", second);
+  ASSERT_EQ(first, cache.Get("q1"));
+  cache.Put("q3", third);
+
+  ASSERT_EQ(first, cache.Get("q1"));
+  ASSERT_EQ(nullptr, cache.Get("q2"));
+  ASSERT_EQ(third, cache.Get("q3"));
+}
+
+TEST(QueryResultCache, SkipsResultsLargerThanBudget) {
+  auto small = MakeResult(10);
+  auto large = MakeResult(1000);
+  QueryResultCache cache(std::chrono::seconds(60), small->size(), false);
+
+  cache.Put("q", small);
+  cache.Put("q", large);
+  ASSERT_EQ(nullptr, cache.Get("q"));
+}
+
+TEST(QueryResultCache, ClearDropsEveryResult) {
+  QueryResultCache cache(std::chrono::seconds(60), 1 << 20, false);
+  cache.Put("q1", MakeResult(10));
+  cache.Put("q2", MakeResult(10));
+
+  cache.Clear();
+  ASSERT_EQ(nullptr, cache.Get("q1"));
+  ASSERT_EQ(nullptr, cache.Get("q2"));
+}
+
+TEST(QueryResultCache, ReturnsCompressedBatches) {
+  auto batch = MakeIds(0, 1000);
+  auto result = CachedResult::Make(IdSchema(), 1000, {batch}, true);
+  ASSERT_TRUE(result.ok());
+
+  auto batches = result.ValueOrDie()->GetBatches();
+  ASSERT_TRUE(batches.ok());
+  ASSERT_EQ(1, batches->size());
+  ASSERT_TRUE(batch->Equals(*batches->front()));
+}
+
+TEST(QueryResultCache, RecorderCachesFinishedResults) {
+  auto cache = std::make_shared<QueryResultCache>(std::chrono::seconds(60), 1 << 20, false);
+  // Servers may not know the row count up front.
+  ResultRecorder recorder(cache, "q", IdSchema(), -1);
+
+  recorder.Add(MakeIds(0, 5));
+  recorder.Add(MakeIds(5, 5));
+  ASSERT_EQ(nullptr, cache->Get("q"));
+  recorder.Finish();
+
+  auto cached = cache->Get("q");
+  ASSERT_NE(nullptr, cached);
+  ASSERT_EQ(-1, cached->total_records());
+  auto batches = cached->GetBatches();
+  ASSERT_TRUE(batches.ok());
+  ASSERT_EQ(2, batches->size());
+}
+
+TEST(QueryResultCache, RecorderAbandonsResultsOverBudget) {
+  auto cache = std::make_shared<QueryResultCache>(std::chrono::seconds(60),
+                                                  MakeResult(10)->size(), false);
+  ResultRecorder recorder(cache, "q", IdSchema(), 1000);
+
+  recorder.Add(MakeIds(0, 1000));
+  recorder.Finish();
+  ASSERT_EQ(nullptr, cache->Get("q"));
+}
+
+} // namespace flight_sql
+} // namespace driver
@@ -10,6 +10,11 @@
 
 #include <arrow/flight/types.h>
 #include <arrow/scalar.h>
+#include <arrow/util/cpu_info.h>
+#include <arrow/util/parallel.h>
+#include <arrow/util/thread_pool.h>
+#include <exception>
+#include <mutex>
 #include <utility>
 
 #include "flight_sql_result_set_column.h"
@@ -30,13 +35,38 @@ using arrow::flight::FlightStreamReader;
 using odbcabstraction::CDataType;
 using odbcabstraction::DriverException;
 
+namespace {
+// Used when the L2 cache size cannot be detected.
+const size_t DEFAULT_CONVERSION_CACHE_BUDGET = 256 * 1024;
+const size_t MIN_CONVERSION_TILE_ROWS = 64;
+
+/// Returns the thread pool the result sets of every connection convert
+/// columns on, created on first use and grown to at least `threads` threads.
+/// Each fetch still runs at most its own connection's ConversionThreads tasks.
+arrow::internal::ThreadPool *GetConversionPool(size_t threads) {
+  static std::mutex mutex;
+  static std::shared_ptr<arrow::internal::ThreadPool> pool;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!pool) {
+    auto pool_result = arrow::internal::ThreadPool::Make(static_cast<int>(threads));
+    ThrowIfNotOK(pool_result.status());
+    pool = std::move(pool_result).ValueUnsafe();
+  } else if (pool->GetCapacity() < static_cast<int>(threads)) {
+    ThrowIfNotOK(pool->SetCapacity(static_cast<int>(threads)));
+  }
+  return pool.get();
+}
+} // namespace
+
 FlightSqlResultSet::FlightSqlResultSet(
     FlightSqlClient &flight_sql_client,
     const arrow::flight::FlightCallOptions &call_options,
     const std::shared_ptr<FlightInfo> &flight_info,
     const std::shared_ptr<RecordBatchTransformer> &transformer,
     odbcabstraction::Diagnostics& diagnostics,
-    const odbcabstraction::MetadataSettings &metadata_settings)
+    const odbcabstraction::MetadataSettings &metadata_settings,
+    std::shared_ptr<FlightInfoPoller> poller,
+    std::shared_ptr<ResultRecorder> recorder)
     :
       metadata_settings_(metadata_settings),
       chunk_buffer_(
@@ -44,7 +74,9 @@ FlightSqlResultSet::FlightSqlResultSet(
         call_options,
         flight_info,
         metadata_settings_.chunk_buffer_capacity_,
-        metadata_settings_.use_extended_flightsql_buffer_),
+        metadata_settings_.use_extended_flightsql_buffer_,
+        std::move(poller),
+        std::move(recorder)),
       transformer_(transformer),
       metadata_(transformer ? new FlightSqlResultSetMetadata(transformer->GetTransformedSchema(),
                                                              metadata_settings_)
@@ -67,6 +99,27 @@ FlightSqlResultSet::FlightSqlResultSet(
   }
 }
 
+FlightSqlResultSet::FlightSqlResultSet(
+    const std::shared_ptr<Schema> &schema,
+    RecordBatchSource source,
+    odbcabstraction::Diagnostics& diagnostics,
+    const odbcabstraction::MetadataSettings &metadata_settings)
+    :
+      metadata_settings_(metadata_settings),
+      chunk_buffer_(std::move(source)),
+      schema_(schema),
+      metadata_(new FlightSqlResultSetMetadata(schema, metadata_settings_)),
+      columns_(metadata_->GetColumnCount()),
+      get_data_offsets_(metadata_->GetColumnCount(), 0),
+      diagnostics_(diagnostics),
+      current_row_(0), num_binding_(0), reset_get_data_(false) {
+  current_chunk_.data = nullptr;
+
+  for (size_t i = 0; i < columns_.size(); ++i) {
+    columns_[i] = FlightSqlResultSetColumn(metadata_settings.use_wide_char_);
+  }
+}
+
 size_t FlightSqlResultSet::Move(size_t rows, size_t bind_offset, size_t bind_type, uint16_t *row_status_array) {
   // Consider it might be the first call to Move() and current_chunk is not
   // populated yet
@@ -90,6 +143,14 @@ size_t FlightSqlResultSet::Move(size_t rows, size_t bind_offset, size_t bind_typ
     std::fill(get_data_offsets_.begin(), get_data_offsets_.end(), 0);
   }
 
+  // There can be unbound columns.
+  std::vector<FlightSqlResultSetColumn *> bound_columns;
+  for (auto &column : columns_) {
+    if (column.is_bound_) {
+      bound_columns.push_back(&column);
+    }
+  }
+
   size_t fetched_rows = 0;
   while (fetched_rows < rows) {
     size_t batch_rows = current_chunk_.data->num_rows();
@@ -113,92 +174,20 @@ size_t FlightSqlResultSet::Move(size_t rows, size_t bind_offset, size_t bind_typ
       continue;
     }
 
-    for (auto & column : columns_) {
-      // There can be unbound columns.
-      if (!column.is_bound_)
-        continue;
-
-      auto *accessor = column.GetAccessorForBinding();
-      ColumnBinding shifted_binding = column.binding_;
-      uint16_t *shifted_row_status_array = row_status_array ? &row_status_array[fetched_rows] : nullptr;
-
-      if (shifted_row_status_array) {
-        std::fill(shifted_row_status_array, &shifted_row_status_array[rows_to_fetch], odbcabstraction::RowStatus_SUCCESS);
-      }
-
-      size_t accessor_rows = 0;
-      try {
-        if (!bind_type) {
-          // Columnar binding. Have the accessor convert multiple rows.
-          if (shifted_binding.buffer) {
-            shifted_binding.buffer =
-                static_cast<uint8_t *>(shifted_binding.buffer) +
-                accessor->GetCellLength(&shifted_binding) * fetched_rows +
-                bind_offset;
-          }
-
-          if (shifted_binding.strlen_buffer) {
-            shifted_binding.strlen_buffer = reinterpret_cast<ssize_t *>(
-                reinterpret_cast<uint8_t *>(
-                    &shifted_binding.strlen_buffer[fetched_rows]) +
-                bind_offset);
-          }
-
-          int64_t value_offset = 0;
-          accessor_rows = accessor->GetColumnarData(&shifted_binding, current_row_, rows_to_fetch, value_offset, false,
-                                                    diagnostics_, shifted_row_status_array);
-        }
-        else {
-          // Row-wise binding. Identify the base position of the buffer and indicator based on the bind offset,
-          // the number of already-fetched rows, and the bind_type holding the size of an application-side row.
-          if (shifted_binding.buffer) {
-            shifted_binding.buffer =
-                static_cast<uint8_t *>(shifted_binding.buffer) + bind_offset +
-                bind_type * fetched_rows;
-          }
-
-          if (shifted_binding.strlen_buffer) {
-            shifted_binding.strlen_buffer = reinterpret_cast<ssize_t *>(
-                reinterpret_cast<uint8_t *>(shifted_binding.strlen_buffer) +
-                bind_offset + bind_type * fetched_rows);
-          }
-
-          // Loop and run the accessor one-row-at-a-time.
-          for (size_t i = 0; i < rows_to_fetch; ++i) {
-            int64_t value_offset = 0;
-
-            // Adjust offsets passed to the accessor as we fetch rows.
-            // Note that current_row_ is updated outside of this loop.
-            accessor_rows += accessor->GetColumnarData(&shifted_binding, current_row_ + i, 1, value_offset, false,
-                                                       diagnostics_, shifted_row_status_array);
-            if (shifted_binding.buffer) {
-              shifted_binding.buffer =
-                  static_cast<uint8_t *>(shifted_binding.buffer) + bind_type;
-            }
-
-            if (shifted_binding.strlen_buffer) {
-              shifted_binding.strlen_buffer = reinterpret_cast<ssize_t *>(
-                  reinterpret_cast<uint8_t *>(shifted_binding.strlen_buffer) +
-                  bind_type);
-            }
-
-            if (shifted_row_status_array) {
-              shifted_row_status_array++;
-            }
-          }
-        }
-      } catch (...) {
-        if (shifted_row_status_array) {
-          std::fill(shifted_row_status_array, &shifted_row_status_array[rows_to_fetch], odbcabstraction::RowStatus_ERROR);
-        }
-        throw;
-      }
-
+    // Reset row statuses once for the whole row so that a status set by one
+    // column is not overwritten when the next column is converted.
+    if (row_status_array) {
+      std::fill(&row_status_array[fetched_rows], &row_status_array[fetched_rows + rows_to_fetch],
+                odbcabstraction::RowStatus_SUCCESS);
+    }
 
-      if (rows_to_fetch != accessor_rows) {
-        throw DriverException(
-            "Expected the same number of rows for all columns");
-      }
+    if (bound_columns.size() > 1 && metadata_settings_.conversion_threads_ > 1) {
+      MoveColumnsInParallel(bound_columns, fetched_rows, rows_to_fetch, bind_offset, bind_type,
+                            row_status_array);
+    } else {
+      MoveColumnRun(bound_columns.data(), bound_columns.size(), fetched_rows, rows_to_fetch,
+                    bind_offset, bind_type,
+                    row_status_array ? &row_status_array[fetched_rows] : nullptr, diagnostics_);
     }
 
     current_row_ += static_cast<int64_t>(rows_to_fetch);
@@ -211,6 +200,163 @@ size_t FlightSqlResultSet::Move(size_t rows, size_t bind_offset, size_t bind_typ
   return fetched_rows;
 }
 
+void FlightSqlResultSet::MoveColumn(FlightSqlResultSetColumn &column, size_t rowset_row,
+                                    int64_t arrow_row, size_t rows, size_t bind_offset,
+                                    size_t bind_type,
+                                    uint16_t *row_status_array,
+                                    odbcabstraction::Diagnostics &diagnostics) {
+  auto *accessor = column.GetAccessorForBinding();
+  ColumnBinding shifted_binding = column.binding_;
+
+  // Identify the base position of the buffer and indicator based on the bind
+  // offset and the rows already written. With column-wise binding cells are
+  // packed; with row-wise binding bind_type holds the size of an
+  // application-side row and the accessor steps that many bytes per row.
+  const size_t buffer_stride = bind_type ? bind_type : accessor->GetCellLength(&shifted_binding);
+  const size_t indicator_stride = bind_type ? bind_type : sizeof(ssize_t);
+  shifted_binding.row_stride = bind_type;
+
+  if (shifted_binding.buffer) {
+    shifted_binding.buffer = static_cast<uint8_t *>(shifted_binding.buffer) +
+                             bind_offset + buffer_stride * rowset_row;
+  }
+
+  if (shifted_binding.strlen_buffer) {
+    shifted_binding.strlen_buffer = reinterpret_cast<ssize_t *>(
+        reinterpret_cast<uint8_t *>(shifted_binding.strlen_buffer) +
+        bind_offset + indicator_stride * rowset_row);
+  }
+
+  size_t accessor_rows = 0;
+  try {
+    int64_t value_offset = 0;
+    accessor_rows = accessor->GetColumnarData(&shifted_binding, arrow_row, rows, value_offset, false,
+                                              diagnostics, row_status_array);
+  } catch (...) {
+    if (row_status_array) {
+      std::fill(row_status_array, &row_status_array[rows], odbcabstraction::RowStatus_ERROR);
+    }
+    throw;
+  }
+
+  if (rows != accessor_rows) {
+    throw DriverException(
+        "Expected the same number of rows for all columns");
+  }
+}
+
+size_t FlightSqlResultSet::GetConversionTileRows(FlightSqlResultSetColumn *const *columns,
+                                                 size_t column_count, size_t rows) const {
+  if (metadata_settings_.conversion_tile_rows_ > 0) {
+    return std::min(metadata_settings_.conversion_tile_rows_, rows);
+  }
+  if (!metadata_settings_.conversion_tiles_from_cache_ || column_count < 2) {
+    return rows;
+  }
+
+  // Size tiles so that the source values and application buffers touched by
+  // one tile of every column stay within half of the L2 cache. The cell
+  // length stands in for the bytes read from the Arrow array as well.
+  static const size_t cache_budget = [] {
+    const int64_t l2_size = arrow::internal::CpuInfo::GetInstance()->CacheSize(
+        arrow::internal::CpuInfo::CacheLevel::L2);
+    return l2_size > 0 ? static_cast<size_t>(l2_size) / 2 : DEFAULT_CONVERSION_CACHE_BUDGET;
+  }();
+
+  size_t bytes_per_row = 0;
+  for (size_t i = 0; i < column_count; ++i) {
+    auto &binding = columns[i]->binding_;
+    bytes_per_row += 2 * columns[i]->GetAccessorForBinding()->GetCellLength(&binding);
+    if (binding.strlen_buffer) {
+      bytes_per_row += sizeof(ssize_t);
+    }
+  }
+
+  size_t tile_rows = cache_budget / std::max<size_t>(bytes_per_row, 1);
+  tile_rows = std::max(MIN_CONVERSION_TILE_ROWS,
+                       tile_rows / MIN_CONVERSION_TILE_ROWS * MIN_CONVERSION_TILE_ROWS);
+  return std::min(tile_rows, rows);
+}
+
+void FlightSqlResultSet::MoveColumnRun(FlightSqlResultSetColumn *const *columns,
+                                       size_t column_count, size_t rowset_row, size_t rows,
+                                       size_t bind_offset, size_t bind_type,
+                                       uint16_t *row_status_array,
+                                       odbcabstraction::Diagnostics &diagnostics) {
+  // Convert every column for one tile of rows before moving to the next, so
+  // large rowsets do not stream each column's buffers through the cache
+  // separately.
+  const size_t tile_rows = GetConversionTileRows(columns, column_count, rows);
+  for (size_t tile_start = 0; tile_start < rows; tile_start += tile_rows) {
+    const size_t tile_length = std::min(tile_rows, rows - tile_start);
+    for (size_t i = 0; i < column_count; ++i) {
+      MoveColumn(*columns[i], rowset_row + tile_start,
+                 current_row_ + static_cast<int64_t>(tile_start), tile_length, bind_offset,
+                 bind_type, row_status_array ? &row_status_array[tile_start] : nullptr,
+                 diagnostics);
+    }
+  }
+}
+
+void FlightSqlResultSet::MoveColumnsInParallel(
+    const std::vector<FlightSqlResultSetColumn *> &bound_columns, size_t rowset_row,
+    size_t rows, size_t bind_offset, size_t bind_type, uint16_t *row_status_array) {
+  const size_t workers = std::min(metadata_settings_.conversion_threads_, bound_columns.size());
+  arrow::internal::ThreadPool *conversion_pool =
+      GetConversionPool(metadata_settings_.conversion_threads_);
+
+  // Each worker converts a contiguous run of columns into its own diagnostics
+  // and row statuses. They are merged in column order afterwards so the
+  // results do not depend on scheduling.
+  std::vector<odbcabstraction::Diagnostics> worker_diagnostics;
+  worker_diagnostics.reserve(workers);
+  for (size_t worker = 0; worker < workers; ++worker) {
+    worker_diagnostics.emplace_back(diagnostics_.GetVendor(), diagnostics_.GetDataSourceComponent(),
+                                    diagnostics_.GetOdbcVersion());
+  }
+  std::vector<std::vector<uint16_t>> worker_row_statuses(
+      row_status_array ? workers : 0,
+      std::vector<uint16_t>(rows, odbcabstraction::RowStatus_SUCCESS));
+  std::vector<std::exception_ptr> worker_errors(workers);
+
+  auto status = arrow::internal::ParallelFor(static_cast<int>(workers), [&](int worker) {
+    const size_t first_column = bound_columns.size() * worker / workers;
+    const size_t last_column = bound_columns.size() * (worker + 1) / workers;
+    uint16_t *worker_row_status =
+        row_status_array ? worker_row_statuses[worker].data() : nullptr;
+    try {
+      MoveColumnRun(&bound_columns[first_column], last_column - first_column, rowset_row, rows,
+                    bind_offset, bind_type, worker_row_status, worker_diagnostics[worker]);
+    } catch (...) {
+      worker_errors[worker] = std::current_exception();
+    }
+    return Status::OK();
+  }, conversion_pool);
+  ThrowIfNotOK(status);
+
+  for (size_t worker = 0; worker < workers; ++worker) {
+    diagnostics_.TakeRecords(worker_diagnostics[worker]);
+    if (!row_status_array) {
+      continue;
+    }
+    for (size_t i = 0; i < rows; ++i) {
+      const uint16_t worker_status = worker_row_statuses[worker][i];
+      uint16_t &row_status = row_status_array[rowset_row + i];
+      if (worker_status == odbcabstraction::RowStatus_ERROR ||
+          (worker_status == odbcabstraction::RowStatus_SUCCESS_WITH_INFO &&
+           row_status == odbcabstraction::RowStatus_SUCCESS)) {
+        row_status = worker_status;
+      }
+    }
+  }
+
+  for (const auto &error : worker_errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
 void FlightSqlResultSet::Close() {
   chunk_buffer_.Close();
   current_chunk_.data = nullptr;
@@ -234,14 +380,15 @@ bool FlightSqlResultSet::GetData(int column_n, int16_t target_type,
   ColumnBinding binding(ConvertCDataTypeFromV2ToV3(target_type), precision, scale, buffer, buffer_length,
                         strlen_buffer);
 
-  auto &column = columns_[column_n - 1];
-  Accessor *accessor = column.GetAccessorForGetData(binding.target_type);
-
-
   // Note: current_row_ is always positioned at the index _after_ the one we are
   // on after calling Move(). So if we want to get data from the _last_ row
   // fetched, we need to subtract one from the current row.
-  accessor->GetColumnarData(&binding, current_row_ - 1, 1, value_offset, true, diagnostics_, nullptr);
+  auto &column = columns_[column_n - 1];
+  int64_t accessor_row = 0;
+  Accessor *accessor = column.GetAccessorForGetData(binding.target_type, current_row_ - 1,
+                                                    accessor_row);
+
+  accessor->GetColumnarData(&binding, accessor_row, 1, value_offset, true, diagnostics_, nullptr);
 
   // Return true = data was fetched (caller maps to SQL_SUCCESS).
   // Truncation warnings are reported via diagnostics and the ODBC handle
@@ -273,7 +420,7 @@ void FlightSqlResultSet::BindColumn(int column_n, int16_t target_type,
 
   ColumnBinding binding(ConvertCDataTypeFromV2ToV3(target_type), precision, scale, buffer, buffer_length,
                         strlen_buffer);
-  column.SetBinding(binding, schema_->field(column_n - 1)->type()->id());
+  column.SetBinding(binding, *schema_->field(column_n - 1)->type());
 }
 
 FlightSqlResultSet::~FlightSqlResultSet() = default;
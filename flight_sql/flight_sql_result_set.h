@@ -49,6 +49,21 @@ private:
   int num_binding_;
   bool reset_get_data_;
 
+  void MoveColumn(FlightSqlResultSetColumn &column, size_t rowset_row, int64_t arrow_row,
+                  size_t rows, size_t bind_offset, size_t bind_type,
+                  uint16_t *row_status_array, odbcabstraction::Diagnostics &diagnostics);
+
+  size_t GetConversionTileRows(FlightSqlResultSetColumn *const *columns, size_t column_count,
+                               size_t rows) const;
+
+  void MoveColumnRun(FlightSqlResultSetColumn *const *columns, size_t column_count,
+                     size_t rowset_row, size_t rows, size_t bind_offset, size_t bind_type,
+                     uint16_t *row_status_array, odbcabstraction::Diagnostics &diagnostics);
+
+  void MoveColumnsInParallel(const std::vector<FlightSqlResultSetColumn *> &bound_columns,
+                             size_t rowset_row, size_t rows, size_t bind_offset,
+                             size_t bind_type, uint16_t *row_status_array);
+
 public:
   ~FlightSqlResultSet() override;
 
@@ -58,6 +73,16 @@ public:
       const std::shared_ptr<FlightInfo> &flight_info,
       const std::shared_ptr<RecordBatchTransformer> &transformer,
       odbcabstraction::Diagnostics& diagnostics,
+      const odbcabstraction::MetadataSettings &metadata_settings,
+      std::shared_ptr<FlightInfoPoller> poller = nullptr,
+      std::shared_ptr<ResultRecorder> recorder = nullptr);
+
+  /// Reads the batches `source` produces, such as those of a cached or
+  /// shared result.
+  FlightSqlResultSet(
+      const std::shared_ptr<Schema> &schema,
+      RecordBatchSource source,
+      odbcabstraction::Diagnostics& diagnostics,
       const odbcabstraction::MetadataSettings &metadata_settings);
 
   void Close() override;
@@ -8,141 +8,128 @@
 #include "accessors/main.h"
 
 #include <odbcabstraction/platform.h>
-#include <boost/functional/hash.hpp>
+#include "utils.h"
 
 namespace driver {
 namespace flight_sql {
 
 using odbcabstraction::CDataType;
 
-typedef std::pair<arrow::Type::type, CDataType> SourceAndTargetPair;
-typedef std::function<Accessor *(arrow::Array *)> AccessorConstructor;
-
 namespace {
 
-const std::unordered_map<SourceAndTargetPair, AccessorConstructor,
-                         boost::hash<SourceAndTargetPair>>
-    ACCESSORS_CONSTRUCTORS = {
-        {SourceAndTargetPair(arrow::Type::type::STRING, CDataType_CHAR),
-         [](arrow::Array *array) {
-           return new StringArrayFlightSqlAccessor<CDataType_CHAR, char>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::STRING, CDataType_WCHAR),
-                CreateWCharStringArrayAccessor},
-        {SourceAndTargetPair(arrow::Type::type::DOUBLE, CDataType_DOUBLE),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<DoubleArray,
-                                                      CDataType_DOUBLE>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::FLOAT, CDataType_FLOAT),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<FloatArray,
-                                                      CDataType_FLOAT>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::INT64, CDataType_SBIGINT),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<Int64Array,
-                                                      CDataType_SBIGINT>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::UINT64, CDataType_UBIGINT),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<UInt64Array,
-                                                      CDataType_UBIGINT>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::INT32, CDataType_SLONG),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<Int32Array,
-                                                      CDataType_SLONG>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::UINT32, CDataType_ULONG),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<UInt32Array,
-                                                      CDataType_ULONG>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::INT16, CDataType_SSHORT),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<Int16Array,
-                                                      CDataType_SSHORT>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::UINT16, CDataType_USHORT),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<UInt16Array,
-                                                      CDataType_USHORT>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::INT8, CDataType_STINYINT),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<Int8Array,
-                                                      CDataType_STINYINT>(
-               array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::UINT8, CDataType_UTINYINT),
-         [](arrow::Array *array) {
-           return new PrimitiveArrayFlightSqlAccessor<UInt8Array,
-                                                      CDataType_UTINYINT>(
-               array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::BOOL, CDataType_BIT),
-         [](arrow::Array *array) {
-           return new BooleanArrayFlightSqlAccessor<CDataType_BIT>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::BINARY, CDataType_BINARY),
-         [](arrow::Array *array) {
-           return new BinaryArrayFlightSqlAccessor<CDataType_BINARY>(array);
-         }},
-        {SourceAndTargetPair(arrow::Type::type::DATE32, CDataType_DATE),
-          [](arrow::Array *array) {
-            return new DateArrayFlightSqlAccessor<CDataType_DATE, Date32Array>(array);
-          }},
-        {SourceAndTargetPair(arrow::Type::type::DATE64, CDataType_DATE),
-          [](arrow::Array *array) {
-            return new DateArrayFlightSqlAccessor<CDataType_DATE, Date64Array>(array);
-          }},
-        {SourceAndTargetPair(arrow::Type::type::TIMESTAMP, CDataType_TIMESTAMP),
-            [](arrow::Array *array) {
-           auto time_type =
-               arrow::internal::checked_pointer_cast<TimestampType>(array->type());
-           auto time_unit = time_type->unit();
-           Accessor* result;
-           switch (time_unit) {
-           case TimeUnit::SECOND:
-             result = new TimestampArrayFlightSqlAccessor<CDataType_TIMESTAMP, TimeUnit::SECOND>(array);
-             break;
-           case TimeUnit::MILLI:
-             result = new TimestampArrayFlightSqlAccessor<CDataType_TIMESTAMP, TimeUnit::MILLI>(array);
-             break;
-           case TimeUnit::MICRO:
-             result = new TimestampArrayFlightSqlAccessor<CDataType_TIMESTAMP, TimeUnit::MICRO>(array);
-             break;
-           case TimeUnit::NANO:
-             result = new TimestampArrayFlightSqlAccessor<CDataType_TIMESTAMP, TimeUnit::NANO>(array);
-             break;
-           default:
-             assert(false);
-             throw DriverException("Unrecognized time unit " + std::to_string(time_unit));
-           }
-           return result;
-          }},
-        {SourceAndTargetPair(arrow::Type::type::TIME32, CDataType_TIME),
-          [](arrow::Array *array) {
-           return CreateTimeAccessor(array, arrow::Type::type::TIME32);
-          }},
-        {SourceAndTargetPair(arrow::Type::type::TIME64, CDataType_TIME),
-          [](arrow::Array *array) {
-           return CreateTimeAccessor(array, arrow::Type::type::TIME64);
-          }},
-        {SourceAndTargetPair(arrow::Type::type::DECIMAL128, CDataType_NUMERIC),
-          [](arrow::Array *array) {
-            return new DecimalArrayFlightSqlAccessor<Decimal128Array, CDataType_NUMERIC>(array);
-          }}};
+typedef Accessor *(*AccessorConstructor)(arrow::Array *);
+
+template <typename ACCESSOR>
+Accessor *MakeAccessor(arrow::Array *array) {
+  return new ACCESSOR(array);
+}
+
+Accessor *MakeTimestampAccessor(arrow::Array *array) {
+  auto time_type =
+      arrow::internal::checked_pointer_cast<TimestampType>(array->type());
+  auto time_unit = time_type->unit();
+  switch (time_unit) {
+  case TimeUnit::SECOND:
+    return new TimestampArrayFlightSqlAccessor<CDataType_TIMESTAMP, TimeUnit::SECOND>(array);
+  case TimeUnit::MILLI:
+    return new TimestampArrayFlightSqlAccessor<CDataType_TIMESTAMP, TimeUnit::MILLI>(array);
+  case TimeUnit::MICRO:
+    return new TimestampArrayFlightSqlAccessor<CDataType_TIMESTAMP, TimeUnit::MICRO>(array);
+  case TimeUnit::NANO:
+    return new TimestampArrayFlightSqlAccessor<CDataType_TIMESTAMP, TimeUnit::NANO>(array);
+  default:
+    assert(false);
+    throw DriverException("Unrecognized time unit " + std::to_string(time_unit));
+  }
+}
+
+Accessor *MakeTime32Accessor(arrow::Array *array) {
+  return CreateTimeAccessor(array, arrow::Type::type::TIME32);
+}
+
+Accessor *MakeTime64Accessor(arrow::Array *array) {
+  return CreateTimeAccessor(array, arrow::Type::type::TIME64);
+}
+
+Accessor *MakeTime32TimestampAccessor(arrow::Array *array) {
+  return CreateTimeAccessor(array, arrow::Type::type::TIME32, CDataType_TIMESTAMP);
+}
+
+Accessor *MakeTime64TimestampAccessor(arrow::Array *array) {
+  return CreateTimeAccessor(array, arrow::Type::type::TIME64, CDataType_TIMESTAMP);
 }
 
+struct AccessorFactory {
+  arrow::Type::type source_type;
+  CDataType target_type;
+  AccessorConstructor constructor;
+};
+
+// Resolved once when a column's accessor is built. Later batches re-point the
+// same accessor through Accessor::SetArray, so this is off the per-batch path.
+constexpr AccessorFactory ACCESSOR_FACTORIES[] = {
+    {arrow::Type::type::STRING, CDataType_CHAR,
+     MakeAccessor<StringArrayFlightSqlAccessor<CDataType_CHAR, char>>},
+    {arrow::Type::type::STRING, CDataType_WCHAR, CreateWCharStringArrayAccessor},
+    {arrow::Type::type::STRING, CDataType_DATE,
+     MakeAccessor<StringToTemporalFlightSqlAccessor<CDataType_DATE>>},
+    {arrow::Type::type::STRING, CDataType_TIME,
+     MakeAccessor<StringToTemporalFlightSqlAccessor<CDataType_TIME>>},
+    {arrow::Type::type::STRING, CDataType_TIMESTAMP,
+     MakeAccessor<StringToTemporalFlightSqlAccessor<CDataType_TIMESTAMP>>},
+    {arrow::Type::type::BOOL, CDataType_BIT,
+     MakeAccessor<BooleanArrayFlightSqlAccessor<CDataType_BIT>>},
+    {arrow::Type::type::BINARY, CDataType_BINARY,
+     MakeAccessor<BinaryArrayFlightSqlAccessor<CDataType_BINARY>>},
+    {arrow::Type::type::BINARY, CDataType_CHAR,
+     MakeAccessor<BinaryToHexFlightSqlAccessor<CDataType_CHAR, char>>},
+    {arrow::Type::type::BINARY, CDataType_WCHAR, CreateWCharBinaryToHexAccessor},
+    {arrow::Type::type::DATE32, CDataType_DATE,
+     MakeAccessor<DateArrayFlightSqlAccessor<CDataType_DATE, Date32Array>>},
+    {arrow::Type::type::DATE64, CDataType_DATE,
+     MakeAccessor<DateArrayFlightSqlAccessor<CDataType_DATE, Date64Array>>},
+    {arrow::Type::type::TIMESTAMP, CDataType_TIMESTAMP, MakeTimestampAccessor},
+    {arrow::Type::type::TIME32, CDataType_TIME, MakeTime32Accessor},
+    {arrow::Type::type::TIME64, CDataType_TIME, MakeTime64Accessor},
+    {arrow::Type::type::TIME32, CDataType_TIMESTAMP, MakeTime32TimestampAccessor},
+    {arrow::Type::type::TIME64, CDataType_TIMESTAMP, MakeTime64TimestampAccessor},
+    {arrow::Type::type::DECIMAL128, CDataType_NUMERIC,
+     MakeAccessor<DecimalArrayFlightSqlAccessor<Decimal128Array, CDataType_NUMERIC>>}};
+
+AccessorConstructor FindAccessorConstructor(arrow::Type::type source_type,
+                                            CDataType target_type) {
+  for (const auto &factory : ACCESSOR_FACTORIES) {
+    if (factory.source_type == source_type && factory.target_type == target_type) {
+      return factory.constructor;
+    }
+  }
+  return nullptr;
+}
+} // namespace
+
 std::unique_ptr<Accessor> CreateAccessor(arrow::Array *source_array,
                                          CDataType target_type) {
-  auto it = ACCESSORS_CONSTRUCTORS.find(
-      SourceAndTargetPair(source_array->type_id(), target_type));
-  if (it != ACCESSORS_CONSTRUCTORS.end()) {
-    auto accessor = it->second(source_array);
-    return std::unique_ptr<Accessor>(accessor);
+  AccessorConstructor constructor =
+      FindAccessorConstructor(source_array->type_id(), target_type);
+  if (constructor) {
+    return std::unique_ptr<Accessor>(constructor(source_array));
+  }
+
+  // Every numeric source/target pair shares one templated accessor.
+  if (IsNumericArrowType(source_array->type_id()) && IsNumericCDataType(target_type)) {
+    return std::unique_ptr<Accessor>(CreateNumericAccessor(source_array, target_type));
+  }
+
+  if (IsIntervalArrowType(source_array->type_id()) && IsIntervalCDataType(target_type)) {
+    return std::unique_ptr<Accessor>(CreateIntervalAccessor(source_array, target_type));
+  }
+
+  if (source_array->type_id() == arrow::Type::type::FIXED_SIZE_BINARY) {
+    return std::unique_ptr<Accessor>(CreateFixedSizeBinaryAccessor(source_array, target_type));
+  }
+
+  if (IsUuidType(*source_array->type())) {
+    return std::unique_ptr<Accessor>(CreateUuidAccessor(source_array, target_type));
   }
 
   std::stringstream ss;
@@ -17,6 +17,9 @@ namespace driver {
 namespace flight_sql {
 
 namespace {
+// Rows converted at a time for SQLGetData reads needing a conversion.
+const int64_t GET_DATA_CONVERSION_WINDOW_ROWS = 1024;
+
 std::shared_ptr<Array>
 CastArray(const std::shared_ptr<arrow::Array> &original_array,
           CDataType target_type) {
@@ -31,29 +34,67 @@ CastArray(const std::shared_ptr<arrow::Array> &original_array,
 }
 } // namespace
 
-std::unique_ptr<Accessor>
+FlightSqlResultSetColumn::CachedAccessor
 FlightSqlResultSetColumn::CreateAccessor(CDataType target_type) {
-  cached_casted_array_ = CastArray(original_array_, target_type);
+  CachedAccessor cached_accessor;
+  cached_accessor.casted_array = CastArray(original_array_, target_type);
+  cached_accessor.accessor =
+      flight_sql::CreateAccessor(cached_accessor.casted_array.get(), target_type);
+  return cached_accessor;
+}
+
+void FlightSqlResultSetColumn::RepointAccessor(CachedAccessor &cached_accessor) {
+  // Every batch of a column shares the same Arrow type, so the existing
+  // accessor only needs to see the new (possibly casted) array.
+  cached_accessor.casted_array =
+      CastArray(original_array_, cached_accessor.accessor->target_type_);
+  cached_accessor.accessor->SetArray(cached_accessor.casted_array.get());
+}
 
-  return flight_sql::CreateAccessor(cached_casted_array_.get(), target_type);
+void FlightSqlResultSetColumn::ConvertGetDataWindow(CachedAccessor &cached_accessor,
+                                                    CDataType target_type, int64_t row) {
+  int64_t window_start = 0;
+  std::shared_ptr<Array> casted_array = original_array_;
+  if (NeedArrayConversion(original_array_->type_id(), target_type)) {
+    // Applications reading with SQLGetData move forward through the rows, so
+    // the window starts at the row requested.
+    window_start = row;
+    casted_array =
+        CastArray(original_array_->Slice(row, GET_DATA_CONVERSION_WINDOW_ROWS), target_type);
+  }
+
+  if (cached_accessor.accessor) {
+    cached_accessor.accessor->SetArray(casted_array.get());
+  } else {
+    cached_accessor.accessor = flight_sql::CreateAccessor(casted_array.get(), target_type);
+  }
+  cached_accessor.window_start = window_start;
+  cached_accessor.casted_array = std::move(casted_array);
 }
 
 Accessor *
-FlightSqlResultSetColumn::GetAccessorForTargetType(CDataType target_type) {
-  // Cast the original array to a type matching the target_type.
-  if (target_type == odbcabstraction::CDataType_DEFAULT) {
-    target_type = ConvertArrowTypeToC(original_array_->type_id(), use_wide_char_);
+FlightSqlResultSetColumn::GetAccessorForTargetType(CDataType target_type, int64_t row,
+                                                   int64_t &accessor_row) {
+  CachedAccessor &cached_accessor = get_data_accessors_[target_type];
+
+  // Convert when this type is first read, when the batch changed, or when the
+  // row falls outside the converted window.
+  const std::shared_ptr<Array> &casted_array = cached_accessor.casted_array;
+  if (!casted_array || row < cached_accessor.window_start ||
+      row >= cached_accessor.window_start + casted_array->length()) {
+    ConvertGetDataWindow(cached_accessor, target_type, row);
   }
 
-  cached_accessor_ = CreateAccessor(target_type);
-  return cached_accessor_.get();
+  accessor_row = row - cached_accessor.window_start;
+  return cached_accessor.accessor.get();
 }
 
 FlightSqlResultSetColumn::FlightSqlResultSetColumn(bool use_wide_char)
     : use_wide_char_(use_wide_char),
       is_bound_(false) {}
 
-void FlightSqlResultSetColumn::SetBinding(const ColumnBinding& new_binding, arrow::Type::type arrow_type) {
+void FlightSqlResultSetColumn::SetBinding(const ColumnBinding& new_binding,
+                                          const arrow::DataType& arrow_type) {
   binding_ = new_binding;
   is_bound_ = true;
 
@@ -68,16 +109,32 @@ void FlightSqlResultSetColumn::SetBinding(const ColumnBinding& new_binding, arro
     binding_.precision = arrow::Decimal128Type::kMaxPrecision;
   }
 
-  // Rebuild the accessor and casted array if the target type changed.
-  if (original_array_ && (!cached_casted_array_ || cached_accessor_->target_type_ != binding_.target_type)) {
-    cached_accessor_ = CreateAccessor(binding_.target_type);
+  // Rebuild the binding accessor if the target type changed.
+  if (original_array_ && (!binding_accessor_.accessor ||
+                          binding_accessor_.accessor->target_type_ != binding_.target_type)) {
+    binding_accessor_ = CreateAccessor(binding_.target_type);
   }
 }
 
 void FlightSqlResultSetColumn::ResetBinding() {
   is_bound_ = false;
-  cached_casted_array_.reset();
-  cached_accessor_.reset();
+  binding_accessor_ = CachedAccessor();
+}
+
+void FlightSqlResultSetColumn::ResetAccessor(std::shared_ptr<Array> array) {
+  original_array_ = std::move(array);
+  if (binding_accessor_.accessor) {
+    RepointAccessor(binding_accessor_);
+  } else if (is_bound_) {
+    binding_accessor_ = CreateAccessor(binding_.target_type);
+  }
+
+  // SQLGetData accessors are re-pointed on their next use, so batches the
+  // application skips over are never converted. Drop the previous batch's
+  // converted data now rather than holding on to it until then.
+  for (auto &entry : get_data_accessors_) {
+    entry.second.casted_array.reset();
+  }
 }
 
 } // namespace flight_sql
@@ -9,6 +9,7 @@
 
 #include <accessors/types.h>
 #include <arrow/array.h>
+#include <unordered_map>
 #include "utils.h"
 
 namespace driver {
@@ -18,13 +19,35 @@ using arrow::Array;
 
 class FlightSqlResultSetColumn {
 private:
+  struct CachedAccessor {
+    // Null once the batch changed and the accessor has not been re-pointed.
+    std::shared_ptr<Array> casted_array;
+    std::unique_ptr<Accessor> accessor;
+    // Row of the original array that row 0 of casted_array corresponds to.
+    int64_t window_start = 0;
+  };
+
   std::shared_ptr<Array> original_array_;
-  std::shared_ptr<Array> cached_casted_array_;
-  std::unique_ptr<Accessor> cached_accessor_;
 
-  std::unique_ptr<Accessor> CreateAccessor(CDataType target_type);
+  // Accessor serving the SQLBindCol binding.
+  CachedAccessor binding_accessor_;
+
+  // Accessors serving SQLGetData, keyed by target C type. They are kept apart
+  // from the binding accessor so that reading a bound column as another type,
+  // or alternating between types, converts each batch at most once per type.
+  // When a conversion is needed, only a window of rows starting at the row
+  // being read is converted, so row-at-a-time reads never cast a whole batch.
+  std::unordered_map<CDataType, CachedAccessor> get_data_accessors_;
+
+  CachedAccessor CreateAccessor(CDataType target_type);
+
+  void RepointAccessor(CachedAccessor &cached_accessor);
 
-  Accessor *GetAccessorForTargetType(CDataType target_type);
+  void ConvertGetDataWindow(CachedAccessor &cached_accessor, CDataType target_type,
+                            int64_t row);
+
+  Accessor *GetAccessorForTargetType(CDataType target_type, int64_t row,
+                                     int64_t &accessor_row);
 
 public:
   FlightSqlResultSetColumn() = default;
@@ -35,35 +58,30 @@ public:
   bool is_bound_;
 
   inline Accessor *GetAccessorForBinding() {
-    return cached_accessor_.get();
+    return binding_accessor_.accessor.get();
   }
 
-  inline Accessor *GetAccessorForGetData(CDataType target_type) {
+  /// \brief Returns an accessor able to read `row` of the current batch as
+  /// `target_type`. The accessor may only hold part of the batch, so
+  /// `accessor_row` receives the row index to pass to it.
+  inline Accessor *GetAccessorForGetData(CDataType target_type, int64_t row,
+                                         int64_t &accessor_row) {
     if (target_type == odbcabstraction::CDataType_DEFAULT) {
-      target_type = ConvertArrowTypeToC(original_array_->type_id(), use_wide_char_);
+      target_type = ConvertArrowTypeToC(*original_array_->type(), use_wide_char_);
     }
 
-    if (cached_accessor_ && cached_accessor_->target_type_ == target_type) {
-      return cached_accessor_.get();
+    if (binding_accessor_.accessor && binding_accessor_.accessor->target_type_ == target_type) {
+      accessor_row = row;
+      return binding_accessor_.accessor.get();
     }
-    return GetAccessorForTargetType(target_type);
+    return GetAccessorForTargetType(target_type, row, accessor_row);
   }
 
-  void SetBinding(const ColumnBinding& new_binding, arrow::Type::type arrow_type);
+  void SetBinding(const ColumnBinding& new_binding, const arrow::DataType& arrow_type);
 
   void ResetBinding();
 
-  inline void ResetAccessor(std::shared_ptr<Array> array) {
-    original_array_ = std::move(array);
-    if (cached_accessor_) {
-      cached_accessor_ = CreateAccessor(cached_accessor_->target_type_);
-    } else if (is_bound_) {
-      cached_accessor_ = CreateAccessor(binding_.target_type);
-    } else {
-      cached_casted_array_.reset();
-      cached_accessor_.reset();
-    }
-  }
+  void ResetAccessor(std::shared_ptr<Array> array);
 };
 } // namespace flight_sql
 } // namespace driver
@@ -7,11 +7,14 @@
 
 #include "flight_sql_statement.h"
 #include <odbcabstraction/platform.h>
+#include "flight_sql_get_tables_reader.h"
 #include "flight_sql_result_set.h"
 #include "flight_sql_result_set_metadata.h"
 #include "flight_sql_statement_get_columns.h"
 #include "flight_sql_statement_get_tables.h"
 #include "flight_sql_statement_get_type_info.h"
+#include "flight_sql_statement_text.h"
+#include "flight_sql_stream_chunk_buffer.h"
 #include "record_batch_transformer.h"
 #include "utils.h"
 #include <arrow/io/memory.h>
@@ -28,6 +31,7 @@ namespace flight_sql {
 using arrow::Result;
 using arrow::Status;
 using arrow::flight::FlightCallOptions;
+using arrow::flight::FlightClient;
 using arrow::flight::FlightClientOptions;
 using arrow::flight::FlightInfo;
 using arrow::flight::Location;
@@ -41,14 +45,36 @@ using driver::odbcabstraction::Statement;
 
 namespace {
 
-void ClosePreparedStatementIfAny(
-    std::shared_ptr<arrow::flight::sql::PreparedStatement>
-        &prepared_statement,
-    const FlightCallOptions &call_options) {
-  if (prepared_statement != nullptr) {
-    ThrowIfNotOK(prepared_statement->Close(call_options));
-    prepared_statement.reset();
+/// Reads the columns of a table from the server catalog.
+std::shared_ptr<arrow::Schema> GetTableSchema(FlightSqlClient &sql_client,
+                                              const FlightCallOptions &call_options,
+                                              const std::string *catalog_name,
+                                              const std::string *schema_name,
+                                              const std::string &table_name) {
+  Result<std::shared_ptr<FlightInfo>> result = sql_client.GetTables(
+      call_options, catalog_name, schema_name, &table_name, true, nullptr);
+  ThrowIfNotOK(result.status());
+
+  FlightStreamChunkBuffer chunk_buffer(sql_client, call_options, result.ValueOrDie());
+  FlightStreamChunk chunk;
+  while (chunk_buffer.GetNext(&chunk)) {
+    GetTablesReader reader(chunk.data);
+    while (reader.Next()) {
+      // Schema and table names are search patterns, so keep only the exact match.
+      if (reader.GetTableName() != table_name ||
+          (schema_name && reader.GetDbSchemaName() != *schema_name)) {
+        continue;
+      }
+
+      auto table_schema = reader.GetSchema();
+      if (!table_schema) {
+        throw DriverException("Cannot read the columns of table " + table_name, "HY000");
+      }
+      return table_schema;
+    }
   }
+
+  throw DriverException("Base table or view not found: " + table_name, "42S02");
 }
 
 } // namespace
@@ -56,27 +82,51 @@ void ClosePreparedStatementIfAny(
 FlightSqlStatement::FlightSqlStatement(
     const odbcabstraction::Diagnostics& diagnostics,
     FlightSqlClient &sql_client,
+    FlightClient *flight_client,
     FlightCallOptions call_options,
-    const odbcabstraction::MetadataSettings& metadata_settings)
+    const odbcabstraction::MetadataSettings& metadata_settings,
+    std::shared_ptr<PreparedStatementCache> prepared_statement_cache,
+    std::shared_ptr<QueryResultCache> result_cache,
+    std::shared_ptr<QueryCoalescer> query_coalescer)
     : diagnostics_("GizmoData", diagnostics.GetDataSourceComponent(), diagnostics.GetOdbcVersion()),
-      sql_client_(sql_client), call_options_(std::move(call_options)), metadata_settings_(metadata_settings) {
+      sql_client_(sql_client), flight_client_(flight_client), call_options_(std::move(call_options)),
+      prepared_statement_cache_(std::move(prepared_statement_cache)),
+      result_cache_(std::move(result_cache)),
+      query_coalescer_(std::move(query_coalescer)),
+      metadata_settings_(metadata_settings) {
   attribute_[METADATA_ID] = static_cast<size_t>(SQL_FALSE);
   attribute_[MAX_LENGTH] = static_cast<size_t>(0);
   attribute_[NOSCAN] = static_cast<size_t>(SQL_NOSCAN_OFF);
   attribute_[QUERY_TIMEOUT] = static_cast<size_t>(0);
+  attribute_[EXECUTE_MODE] = static_cast<size_t>(EXECUTE_AUTO);
   call_options_.timeout = TimeoutDuration{-1};
+  call_options_.stop_token = stop_source_.token();
 }
 
 FlightSqlStatement::~FlightSqlStatement() {
-  // Explicitly close the prepared statement with auth headers before destruction.
+  // A bulk load still open here was never finished, so it is abandoned.
+  bulk_loader_.reset();
+
+  // The statements of a batch nobody got to are not executed anymore.
+  DiscardPendingResults();
+
+  // Return the prepared statement to the connection cache. Handles that do not
+  // fit are explicitly closed with auth headers before destruction, since
   // Arrow 23's PreparedStatement destructor calls Close() with empty options,
   // which fails when the server requires authentication.
-  if (prepared_statement_ != nullptr) {
-    auto status = prepared_statement_->Close(call_options_);
-    // Ignore errors during destruction — the statement is going away regardless.
-    (void)status;
-    prepared_statement_.reset();
+  ReleasePreparedStatement();
+}
+
+void FlightSqlStatement::ReleasePreparedStatement() {
+  if (prepared_statement_ == nullptr) {
+    return;
   }
+
+  ClosePreparedStatements(
+      prepared_statement_cache_->Release(prepared_statement_key_, std::move(prepared_statement_),
+                                         prepared_statement_generation_),
+      call_options_);
+  prepared_statement_.reset();
 }
 
 bool FlightSqlStatement::SetAttribute(StatementAttributeId attribute,
@@ -88,6 +138,14 @@ bool FlightSqlStatement::SetAttribute(StatementAttributeId attribute,
     return CheckIfSetToOnlyValidValue(value, static_cast<size_t>(SQL_NOSCAN_OFF));
   case MAX_LENGTH:
     return CheckIfSetToOnlyValidValue(value, static_cast<size_t>(0));
+  case QUERY_PROGRESS:
+    throw DriverException("Cannot set read-only attribute", "HY092");
+  case EXECUTE_MODE:
+    if (boost::get<size_t>(value) > EXECUTE_UPDATE) {
+      throw DriverException("Invalid attribute value", "HY024");
+    }
+    attribute_[attribute] = value;
+    return true;
   case QUERY_TIMEOUT:
     if (boost::get<size_t>(value) > 0) {
       call_options_.timeout =
@@ -104,19 +162,55 @@ bool FlightSqlStatement::SetAttribute(StatementAttributeId attribute,
 
 boost::optional<Statement::Attribute>
 FlightSqlStatement::GetAttribute(StatementAttributeId attribute) {
+  if (attribute == QUERY_PROGRESS) {
+    double progress = poller_ ? poller_->progress() : (flight_info_ || update_count_ >= 0 ? 1 : 0);
+    return Attribute(static_cast<size_t>(progress * 100));
+  }
+
   const auto &it = attribute_.find(attribute);
   return boost::make_optional(it != attribute_.end(), it->second);
 }
 
 boost::optional<std::shared_ptr<ResultSetMetadata>>
 FlightSqlStatement::Prepare(const std::string &query) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
+  DiscardPendingResults();
+  prepare_deferred_ = false;
+
+  // A cached handle for the same query skips the round trip to the server.
+  prepared_statement_key_ = NormalizeSqlForCache(query);
+  prepared_statement_generation_ = prepared_statement_cache_->generation();
+  prepared_statement_ = prepared_statement_cache_->Acquire(prepared_statement_key_);
+  prepared_statement_is_update_ = RunsAsUpdate(query);
+  prepared_statement_is_read_only_ =
+      !prepared_statement_is_update_ && IsReadOnlyStatement(query);
+
+  if (prepared_statement_ == nullptr) {
+    deferred_query_ = query;
+    prepare_deferred_ = true;
+    if (metadata_settings_.defer_prepare_) {
+      return boost::none;
+    }
+  }
+  return DescribePrepared();
+}
+
+void FlightSqlStatement::CompleteDeferredPrepare() {
+  if (!prepare_deferred_) {
+    return;
+  }
 
   Result<std::shared_ptr<PreparedStatement>> result =
-      sql_client_.Prepare(call_options_, query);
+      sql_client_.Prepare(call_options_, deferred_query_);
   ThrowIfNotOK(result.status());
 
   prepared_statement_ = *result;
+  prepare_deferred_ = false;
+}
+
+boost::optional<std::shared_ptr<ResultSetMetadata>> FlightSqlStatement::DescribePrepared() {
+  CompleteDeferredPrepare();
+  assert(prepared_statement_.get() != nullptr);
 
   const auto &result_set_metadata =
       std::make_shared<FlightSqlResultSetMetadata>(
@@ -125,10 +219,69 @@ FlightSqlStatement::Prepare(const std::string &query) {
       result_set_metadata);
 }
 
-bool FlightSqlStatement::ExecutePrepared() {
+std::shared_ptr<ResultSetMetadata> FlightSqlStatement::GetParameterMetadata() {
+  CompleteDeferredPrepare();
+  assert(prepared_statement_.get() != nullptr);
+
+  auto parameter_schema = prepared_statement_->parameter_schema();
+  return std::make_shared<FlightSqlResultSetMetadata>(
+      parameter_schema ? parameter_schema : arrow::schema({}), metadata_settings_);
+}
+
+void FlightSqlStatement::BindParameter(int parameter, int16_t c_type, int16_t sql_type,
+                                       int precision, int scale, void *buffer,
+                                       size_t buffer_length, ssize_t *strlen_buffer) {
+  if (parameter_bindings_.size() < static_cast<size_t>(parameter)) {
+    parameter_bindings_.resize(parameter);
+  }
+  parameter_bindings_[parameter - 1] =
+      ParameterBinding(ConvertCDataTypeFromV2ToV3(c_type), sql_type, precision, scale, buffer,
+                       buffer_length, strlen_buffer);
+
+  // Drop trailing unbound parameters so the count reflects the bindings.
+  while (!parameter_bindings_.empty() && !parameter_bindings_.back().IsBound()) {
+    parameter_bindings_.pop_back();
+  }
+}
+
+bool FlightSqlStatement::ExecutePrepared(size_t paramset_size, size_t bind_offset,
+                                         size_t bind_type,
+                                         const uint16_t *operation_array) {
+  if (prepare_deferred_) {
+    // Without parameters to send, the query runs directly, and is never
+    // prepared on the server.
+    if (parameter_bindings_.empty()) {
+      return ExecuteStatement(deferred_query_);
+    }
+    CompleteDeferredPrepare();
+  }
   assert(prepared_statement_.get() != nullptr);
 
+  // Every parameter set travels in one batch, so the server executes them
+  // all in a single round trip.
+  const auto &parameter_schema = prepared_statement_->parameter_schema();
+  if (!parameter_bindings_.empty() ||
+      (parameter_schema && parameter_schema->num_fields() > 0)) {
+    ThrowIfNotOK(prepared_statement_->SetParameters(
+        BuildParameterBatch(parameter_bindings_, parameter_schema, paramset_size, bind_offset,
+                            bind_type, operation_array)));
+  }
+
+  if (!prepared_statement_is_read_only_) {
+    InvalidateSharedResults();
+  }
+  if (prepared_statement_is_update_) {
+    const Result<int64_t> result = prepared_statement_->ExecuteUpdate(call_options_);
+    InvalidatePreparedStatements(prepared_statement_key_);
+    SetUpdateResult(result);
+    return false;
+  }
+
+  poller_.reset();
   Result<std::shared_ptr<FlightInfo>> result = prepared_statement_->Execute(call_options_);
+  if (!prepared_statement_is_read_only_) {
+    InvalidatePreparedStatements(prepared_statement_key_);
+  }
   ThrowIfNotOK(result.status());
 
   flight_info_ = result.ValueOrDie();
@@ -140,33 +293,421 @@ bool FlightSqlStatement::ExecutePrepared() {
   return true;
 }
 
+void FlightSqlStatement::BindBulkColumn(int column, const std::string &column_name,
+                                        int16_t c_type, int precision, int scale, void *buffer,
+                                        size_t buffer_length, ssize_t *strlen_buffer) {
+  if (bulk_bindings_.size() < static_cast<size_t>(column)) {
+    bulk_bindings_.resize(column);
+    bulk_column_names_.resize(column);
+  }
+  bulk_bindings_[column - 1] =
+      ParameterBinding(ConvertCDataTypeFromV2ToV3(c_type), 0, precision, scale, buffer,
+                       buffer_length, strlen_buffer);
+  bulk_column_names_[column - 1] = column_name;
+
+  while (!bulk_bindings_.empty() && !bulk_bindings_.back().IsBound()) {
+    bulk_bindings_.pop_back();
+    bulk_column_names_.pop_back();
+  }
+}
+
+size_t FlightSqlStatement::BulkAdd(const std::string *catalog_name,
+                                   const std::string *schema_name,
+                                   const std::string &table_name, size_t rows,
+                                   size_t bind_offset, size_t bind_type,
+                                   const uint16_t *operation_array) {
+  const optional<std::string> catalog =
+      catalog_name ? optional<std::string>(*catalog_name) : std::nullopt;
+  const optional<std::string> db_schema =
+      schema_name ? optional<std::string>(*schema_name) : std::nullopt;
+
+  if (!bulk_table_schema_ || table_name != bulk_table_ || db_schema != bulk_db_schema_ ||
+      catalog != bulk_catalog_) {
+    FinishBulkLoad();
+    bulk_table_schema_ =
+        GetTableSchema(sql_client_, call_options_, catalog_name, schema_name, table_name);
+    bulk_table_ = table_name;
+    bulk_db_schema_ = db_schema;
+    bulk_catalog_ = catalog;
+  }
+
+  // Only bound columns are sent; the server fills in the others.
+  std::vector<ParameterBinding> bindings;
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  for (size_t i = 0; i < bulk_bindings_.size(); ++i) {
+    if (!bulk_bindings_[i].IsBound()) {
+      continue;
+    }
+
+    const std::string &column_name = bulk_column_names_[i];
+    std::shared_ptr<arrow::Field> field;
+    if (!column_name.empty()) {
+      field = bulk_table_schema_->GetFieldByName(column_name);
+    } else if (i < static_cast<size_t>(bulk_table_schema_->num_fields())) {
+      field = bulk_table_schema_->field(static_cast<int>(i));
+    }
+    if (!field) {
+      throw DriverException("Column not found: " +
+                                (column_name.empty() ? std::to_string(i + 1) : column_name),
+                            "42S22");
+    }
+
+    ParameterBinding binding = bulk_bindings_[i];
+    if (binding.target_type == odbcabstraction::CDataType_DEFAULT) {
+      binding.target_type = ConvertArrowTypeToC(*field->type(), metadata_settings_.use_wide_char_);
+    }
+    bindings.push_back(binding);
+    fields.push_back(field);
+  }
+  if (bindings.empty()) {
+    throw DriverException("No columns are bound", "07002");
+  }
+
+  auto batch = BuildParameterBatch(bindings, arrow::schema(fields), rows, bind_offset, bind_type,
+                                   operation_array);
+
+  // Every batch of a load must share one schema, so binding other columns
+  // starts a new load.
+  if (bulk_loader_ && !bulk_loader_->schema()->Equals(*batch->schema())) {
+    FinishBulkLoad();
+  }
+  if (!bulk_loader_) {
+    auto ingest = [&sql_client = sql_client_, call_options = call_options_, table = table_name,
+                   db_schema, catalog](const std::shared_ptr<arrow::RecordBatchReader> &reader,
+                                       const arrow::StopToken &stop_token) {
+      FlightCallOptions ingest_call_options = call_options;
+      ingest_call_options.stop_token = stop_token;
+
+      arrow::flight::sql::TableDefinitionOptions table_definition_options;
+      table_definition_options.if_not_exist =
+          arrow::flight::sql::TableDefinitionOptionsTableNotExistOption::kFail;
+      table_definition_options.if_exists =
+          arrow::flight::sql::TableDefinitionOptionsTableExistsOption::kAppend;
+      return sql_client.ExecuteIngest(ingest_call_options, reader, table_definition_options,
+                                      table, db_schema, catalog, false);
+    };
+    bulk_loader_ = std::make_unique<FlightSqlBulkLoader>(
+        batch->schema(), std::move(ingest), metadata_settings_.ingest_batch_rows_,
+        metadata_settings_.ingest_buffer_capacity_);
+  }
+
+  try {
+    bulk_loader_->Append(batch);
+  } catch (...) {
+    bulk_loader_.reset();
+    throw;
+  }
+  return static_cast<size_t>(batch->num_rows());
+}
+
+void FlightSqlStatement::FinishBulkLoad() {
+  if (!bulk_loader_) {
+    return;
+  }
+
+  // The load is over even if the server rejects it.
+  auto bulk_loader = std::move(bulk_loader_);
+  InvalidateSharedResults();
+  update_count_ = static_cast<long>(bulk_loader->Finish());
+}
+
 bool FlightSqlStatement::Execute(const std::string &query) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
+  DiscardPendingResults();
+  prepare_deferred_ = false;
+
+  std::vector<std::string> statements = SplitSqlStatements(query);
+  if (statements.size() > 1) {
+    batch_statements_ = std::move(statements);
+    batch_position_ = 0;
+    return ExecuteBatchStatement();
+  }
+  return ExecuteStatement(query);
+}
+
+bool FlightSqlStatement::RunsAsUpdate(const std::string &query) {
+  switch (boost::get<size_t>(attribute_[EXECUTE_MODE])) {
+  case EXECUTE_QUERY:
+    return false;
+  case EXECUTE_UPDATE:
+    return true;
+  default:
+    return IsUpdateStatement(query);
+  }
+}
 
-  Result<std::shared_ptr<FlightInfo>> result =
-      sql_client_.Execute(call_options_, query);
+void FlightSqlStatement::SetUpdateResult(const Result<int64_t> &result) {
   ThrowIfNotOK(result.status());
 
-  flight_info_ = result.ValueOrDie();
+  // The row count comes back with the call, without a result set to stream.
+  poller_.reset();
+  flight_info_.reset();
+  current_result_set_.reset();
+  update_count_ = static_cast<long>(result.ValueOrDie());
+}
 
-  update_count_ = flight_info_->total_records();
+void FlightSqlStatement::InvalidateSharedResults() {
+  if (result_cache_) {
+    result_cache_->Clear();
+  }
+  if (query_coalescer_) {
+    query_coalescer_->Clear();
+  }
+}
+
+void FlightSqlStatement::InvalidatePreparedStatements(const std::string &statement) {
+  // Servers plan prepared statements against the schema objects a statement
+  // like ALTER or DROP changes, so the cached handles are closed after one.
+  // Handles other statements hold are closed when they are released.
+  if (IsSchemaChangeStatement(statement)) {
+    ClosePreparedStatements(prepared_statement_cache_->Clear(), call_options_);
+  }
+}
+
+void FlightSqlStatement::WatchSharedReader(
+    const std::shared_ptr<CoalescedQuery::Reader> &reader) {
+  {
+    std::lock_guard<std::mutex> lock(interrupt_mutex_);
+    shared_reader_ = reader;
+  }
+  // Interrupt found no reader to stop if it came first.
+  if (stop_source_.token().IsStopRequested()) {
+    reader->Interrupt();
+  }
+}
+
+void FlightSqlStatement::SetSharedResult(std::shared_ptr<CoalescedQuery::Reader> reader) {
+  // The execution is not this statement's own, so cancelling the statement
+  // must not cancel it on the server.
+  flight_info_.reset();
+  update_count_ = static_cast<long>(reader->query()->total_records());
+  const auto schema = reader->query()->schema();
   current_result_set_ = std::make_shared<FlightSqlResultSet>(
-      sql_client_, call_options_, flight_info_, nullptr, diagnostics_, metadata_settings_);
+      schema,
+      [reader = std::move(reader)](std::shared_ptr<arrow::RecordBatch> *batch) {
+        return reader->Next(batch);
+      },
+      diagnostics_, metadata_settings_);
+}
+
+void FlightSqlStatement::SetCachedResult(const CachedResult &cached) {
+  Result<std::vector<std::shared_ptr<arrow::RecordBatch>>> result = cached.GetBatches();
+  ThrowIfNotOK(result.status());
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches = std::move(result).ValueOrDie();
+
+  // The row count is the one the server reported, as for a miss.
+  poller_.reset();
+  flight_info_.reset();
+  update_count_ = static_cast<long>(cached.total_records());
+  auto source = [batches = std::move(batches),
+                 position = size_t(0)](std::shared_ptr<arrow::RecordBatch> *batch) mutable {
+    if (position == batches.size()) {
+      return false;
+    }
+    *batch = batches[position++];
+    return true;
+  };
+  current_result_set_ = std::make_shared<FlightSqlResultSet>(
+      cached.schema(), std::move(source), diagnostics_, metadata_settings_);
+}
+
+bool FlightSqlStatement::ExecuteStatement(const std::string &query) {
+  const bool runs_as_update = RunsAsUpdate(query);
+  const bool read_only = !runs_as_update && IsReadOnlyStatement(query);
+  if (!read_only) {
+    InvalidateSharedResults();
+  }
+
+  if (runs_as_update) {
+    const Result<int64_t> result = sql_client_.ExecuteUpdate(call_options_, query);
+    InvalidatePreparedStatements(query);
+    SetUpdateResult(result);
+    return false;
+  }
+
+  std::string key;
+  if (read_only && (result_cache_ || query_coalescer_)) {
+    key = NormalizeSqlForCache(query);
+  }
+  if (read_only && result_cache_) {
+    if (auto cached = result_cache_->Get(key)) {
+      SetCachedResult(*cached);
+      return true;
+    }
+  }
+
+  // Statements executing the same query meanwhile share this execution.
+  std::shared_ptr<CoalescedQuery::Reader> shared_reader;
+  if (read_only && query_coalescer_) {
+    bool leader = false;
+    shared_reader = query_coalescer_->Join(key, &leader);
+    WatchSharedReader(shared_reader);
+    if (!leader) {
+      if (shared_reader->WaitUntilStarted()) {
+        poller_.reset();
+        SetSharedResult(std::move(shared_reader));
+        return true;
+      }
+      // The statement executing the query failed, maybe because it was
+      // interrupted, so this one executes it by itself.
+      shared_reader.reset();
+    }
+  }
+
+  poller_.reset();
+  try {
+    // Servers without PollFlightInfo get the query through GetFlightInfo.
+    if (metadata_settings_.use_poll_flight_info_ && flight_client_ != nullptr) {
+      poller_ = FlightInfoPoller::Start(*flight_client_, call_options_, query);
+      // Interrupt stops it from another thread. A poller started after
+      // Interrupt sees the statement's token fired by itself.
+      std::lock_guard<std::mutex> lock(interrupt_mutex_);
+      interruptible_poller_ = poller_;
+    }
+
+    if (poller_) {
+      flight_info_ = poller_->flight_info();
+    } else {
+      Result<std::shared_ptr<FlightInfo>> result =
+          sql_client_.Execute(call_options_, query);
+      ThrowIfNotOK(result.status());
+
+      flight_info_ = result.ValueOrDie();
+    }
+    update_count_ = flight_info_->total_records();
+    if (!read_only) {
+      InvalidatePreparedStatements(query);
+    }
+
+    std::shared_ptr<arrow::Schema> schema;
+    if ((read_only && result_cache_) || shared_reader) {
+      auto schema_result = flight_info_->GetSchema(nullptr);
+      ThrowIfNotOK(schema_result.status());
+      schema = std::move(schema_result).ValueOrDie();
+    }
+
+    // The result is cached once it was read to the end.
+    std::shared_ptr<ResultRecorder> recorder;
+    if (read_only && result_cache_) {
+      recorder = std::make_shared<ResultRecorder>(result_cache_, key, schema, update_count_);
+    }
+
+    if (!shared_reader) {
+      current_result_set_ = std::make_shared<FlightSqlResultSet>(
+          sql_client_, call_options_, flight_info_, nullptr, diagnostics_, metadata_settings_,
+          poller_, std::move(recorder));
+      return true;
+    }
 
+    // The stream outlives this statement while others read it, so it only
+    // stops once none of them is left reading.
+    FlightCallOptions stream_call_options = call_options_;
+    stream_call_options.stop_token = shared_reader->query()->stop_token();
+    auto chunk_buffer = std::make_shared<FlightStreamChunkBuffer>(
+        sql_client_, stream_call_options, flight_info_,
+        metadata_settings_.chunk_buffer_capacity_,
+        metadata_settings_.use_extended_flightsql_buffer_, poller_, std::move(recorder));
+    shared_reader->query()->Start(
+        schema, update_count_, metadata_settings_.chunk_buffer_capacity_,
+        [chunk_buffer](std::shared_ptr<arrow::RecordBatch> *batch) {
+          FlightStreamChunk chunk;
+          if (!chunk_buffer->GetNext(&chunk)) {
+            return false;
+          }
+          *batch = std::move(chunk.data);
+          return true;
+        });
+  } catch (...) {
+    if (shared_reader) {
+      shared_reader->query()->Fail();
+    }
+    throw;
+  }
+
+  SetSharedResult(std::move(shared_reader));
   return true;
 }
 
+bool FlightSqlStatement::ExecuteBatchStatement() {
+  const std::string &query = batch_statements_[batch_position_];
+  bool has_result_set = true;
+  if (next_flight_info_.valid()) {
+    Result<std::shared_ptr<FlightInfo>> result = next_flight_info_.get();
+    poller_.reset();
+    ThrowIfNotOK(result.status());
+
+    flight_info_ = result.ValueOrDie();
+    update_count_ = flight_info_->total_records();
+    current_result_set_ = std::make_shared<FlightSqlResultSet>(
+        sql_client_, call_options_, flight_info_, nullptr, diagnostics_, metadata_settings_);
+  } else {
+    has_result_set = ExecuteStatement(query);
+  }
+
+  // Executing the next statement while these results stream saves a round
+  // trip, as long as neither statement changes what the other one sees.
+  if (batch_position_ + 1 < batch_statements_.size() && IsReadOnlyStatement(query) &&
+      IsReadOnlyStatement(batch_statements_[batch_position_ + 1]) &&
+      !RunsAsUpdate(batch_statements_[batch_position_ + 1])) {
+    FlightSqlClient &sql_client = sql_client_;
+    next_flight_info_ = std::async(
+        std::launch::async,
+        [&sql_client, call_options = call_options_,
+         next = batch_statements_[batch_position_ + 1]] {
+          return sql_client.Execute(call_options, next);
+        });
+  }
+  return has_result_set;
+}
+
 std::shared_ptr<ResultSet> FlightSqlStatement::GetResultSet() {
   return current_result_set_;
 }
 
 long FlightSqlStatement::GetUpdateCount() { return update_count_; }
 
+bool FlightSqlStatement::NextResult() {
+  if (batch_position_ + 1 >= batch_statements_.size()) {
+    DiscardPendingResults();
+    return false;
+  }
+
+  if (current_result_set_) {
+    current_result_set_->Close();
+    current_result_set_.reset();
+  }
+  ++batch_position_;
+  try {
+    ExecuteBatchStatement();
+  } catch (...) {
+    // The statements after a failed one are not executed.
+    DiscardPendingResults();
+    throw;
+  }
+  return true;
+}
+
+void FlightSqlStatement::DiscardPendingResults() {
+  // The statements not reached yet are dropped without being executed.
+  if (next_flight_info_.valid()) {
+    // The server stops running the statement executed ahead of time, since
+    // nobody reads its results. Best-effort, like Cancel.
+    Result<std::shared_ptr<FlightInfo>> result = next_flight_info_.get();
+    if (result.ok()) {
+      arrow::flight::CancelFlightInfoRequest request(
+          std::make_unique<FlightInfo>(*result.ValueOrDie()));
+      (void)sql_client_.CancelFlightInfo(call_options_, request);
+    }
+  }
+  batch_statements_.clear();
+  batch_position_ = 0;
+}
+
 std::shared_ptr<odbcabstraction::ResultSet> FlightSqlStatement::GetTables(
     const std::string *catalog_name, const std::string *schema_name,
     const std::string *table_name, const std::string *table_type,
     const ColumnNames &column_names) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
 
   std::vector<std::string> table_types;
 
@@ -224,7 +765,7 @@ std::shared_ptr<ResultSet> FlightSqlStatement::GetTables_V3(
 std::shared_ptr<ResultSet> FlightSqlStatement::GetColumns_V2(
     const std::string *catalog_name, const std::string *schema_name,
     const std::string *table_name, const std::string *column_name) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
 
   Result<std::shared_ptr<FlightInfo>> result = sql_client_.GetTables(
       call_options_, catalog_name, schema_name, table_name, true, nullptr);
@@ -244,7 +785,7 @@ std::shared_ptr<ResultSet> FlightSqlStatement::GetColumns_V2(
 std::shared_ptr<ResultSet> FlightSqlStatement::GetColumns_V3(
     const std::string *catalog_name, const std::string *schema_name,
     const std::string *table_name, const std::string *column_name) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
 
   Result<std::shared_ptr<FlightInfo>> result = sql_client_.GetTables(
       call_options_, catalog_name, schema_name, table_name, true, nullptr);
@@ -262,7 +803,7 @@ std::shared_ptr<ResultSet> FlightSqlStatement::GetColumns_V3(
 }
 
 std::shared_ptr<ResultSet> FlightSqlStatement::GetTypeInfo_V2(int16_t data_type) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
 
   Result<std::shared_ptr<FlightInfo>> result = sql_client_.GetXdbcTypeInfo(
           call_options_);
@@ -280,7 +821,7 @@ std::shared_ptr<ResultSet> FlightSqlStatement::GetTypeInfo_V2(int16_t data_type)
 }
 
 std::shared_ptr<ResultSet> FlightSqlStatement::GetTypeInfo_V3(int16_t data_type) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
 
   Result<std::shared_ptr<FlightInfo>> result = sql_client_.GetXdbcTypeInfo(
           call_options_);
@@ -300,7 +841,7 @@ std::shared_ptr<ResultSet> FlightSqlStatement::GetTypeInfo_V3(int16_t data_type)
 std::shared_ptr<ResultSet> FlightSqlStatement::GetPrimaryKeys(
     const std::string *catalog_name, const std::string *schema_name,
     const std::string *table_name) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
 
   auto schema = arrow::schema({
     arrow::field("TABLE_CAT", arrow::utf8(), true),      // nullable
@@ -327,7 +868,7 @@ std::shared_ptr<ResultSet> FlightSqlStatement::GetForeignKeys(
     const std::string *pk_catalog_name, const std::string *pk_schema_name,
     const std::string *pk_table_name, const std::string *fk_catalog_name,
     const std::string *fk_schema_name, const std::string *fk_table_name) {
-  ClosePreparedStatementIfAny(prepared_statement_, call_options_);
+  ReleasePreparedStatement();
 
   auto schema = arrow::schema({
     arrow::field("PKTABLE_CAT", arrow::utf8(), true),     // nullable
@@ -376,5 +917,25 @@ void FlightSqlStatement::Cancel() {
   current_result_set_->Cancel();
 }
 
+void FlightSqlStatement::Interrupt() {
+  // Result sets copy the call options, so their streams stop as well.
+  stop_source_.RequestStop();
+
+  // A shared execution keeps streaming to the other statements reading it,
+  // so only the waits of this statement's reader stop.
+  std::lock_guard<std::mutex> lock(interrupt_mutex_);
+  if (auto reader = shared_reader_.lock()) {
+    reader->Interrupt();
+  }
+  // The poller polls on a token of its own, so the poll in progress is
+  // interrupted through Stop. It then fails with HY008 since the statement's
+  // token fired first.
+  if (auto poller = interruptible_poller_.lock()) {
+    poller->Stop();
+  }
+}
+
+void FlightSqlStatement::ClearInterrupt() { stop_source_.Reset(); }
+
 } // namespace flight_sql
 } // namespace driver
@@ -7,6 +7,12 @@
 
 #pragma once
 
+#include "flight_sql_bulk_loader.h"
+#include "flight_sql_flight_info_poller.h"
+#include "flight_sql_parameter_batch.h"
+#include "flight_sql_prepared_statement_cache.h"
+#include "flight_sql_query_coalescer.h"
+#include "flight_sql_result_cache.h"
 #include "flight_sql_statement_get_tables.h"
 #include "odbcabstraction/types.h"
 #include <odbcabstraction/spi/statement.h>
@@ -15,6 +21,11 @@
 #include <arrow/flight/api.h>
 #include <arrow/flight/sql/api.h>
 #include <arrow/flight/types.h>
+#include <arrow/util/cancel.h>
+
+#include <future>
+#include <mutex>
+#include <optional>
 
 namespace driver {
 namespace flight_sql {
@@ -25,13 +36,99 @@ private:
   odbcabstraction::Diagnostics diagnostics_;
   std::map<StatementAttributeId, Attribute> attribute_;
   arrow::flight::FlightCallOptions call_options_;
+  // Stops the server calls made with call_options_ when interrupted.
+  arrow::StopSource stop_source_;
   arrow::flight::sql::FlightSqlClient &sql_client_;
+  // Client the SQL client wraps, for PollFlightInfo. May be null.
+  arrow::flight::FlightClient *flight_client_;
   std::shared_ptr<odbcabstraction::ResultSet> current_result_set_;
   std::shared_ptr<arrow::flight::sql::PreparedStatement> prepared_statement_;
+  // Connection cache the prepared statement is returned to, and its key there.
+  std::shared_ptr<PreparedStatementCache> prepared_statement_cache_;
+  std::string prepared_statement_key_;
+  // Cache generation read when the prepared statement was acquired.
+  uint64_t prepared_statement_generation_ = 0;
+  // Query Prepare recorded without preparing it on the server yet.
+  std::string deferred_query_;
+  bool prepare_deferred_ = false;
+  // Whether the prepared statement runs as an update.
+  bool prepared_statement_is_update_ = false;
+  // Whether the prepared statement only reads, leaving the result cache valid.
+  bool prepared_statement_is_read_only_ = false;
+  // Connection result cache, or null when disabled.
+  std::shared_ptr<QueryResultCache> result_cache_;
+  // Connection registry of queries in flight, or null when not coalescing.
+  std::shared_ptr<QueryCoalescer> query_coalescer_;
+  // Reader of the last execution joined through query_coalescer_, and poller
+  // of the last query executed by polling, which Interrupt stops from another
+  // thread.
+  std::mutex interrupt_mutex_;
+  std::weak_ptr<CoalescedQuery::Reader> shared_reader_;
+  std::weak_ptr<FlightInfoPoller> interruptible_poller_;
   std::shared_ptr<arrow::flight::FlightInfo> flight_info_;
+  // Follows the last query while the server runs it, if executed by polling.
+  std::shared_ptr<FlightInfoPoller> poller_;
   const odbcabstraction::MetadataSettings& metadata_settings_;
+  std::vector<ParameterBinding> parameter_bindings_;
   long update_count_ = -1;
 
+  // Statements of the batch executed last, and the one whose results are current.
+  std::vector<std::string> batch_statements_;
+  size_t batch_position_ = 0;
+  // Execution of the next statement of the batch, started ahead of time.
+  std::future<arrow::Result<std::shared_ptr<arrow::flight::FlightInfo>>> next_flight_info_;
+
+  // Columns bound for bulk loads, with the table columns they load into.
+  std::vector<ParameterBinding> bulk_bindings_;
+  std::vector<std::string> bulk_column_names_;
+  // Table targeted by the last bulk load, and its schema.
+  std::string bulk_table_;
+  std::optional<std::string> bulk_db_schema_;
+  std::optional<std::string> bulk_catalog_;
+  std::shared_ptr<arrow::Schema> bulk_table_schema_;
+  // Declared last so the upload stops before the members it uses go away.
+  std::unique_ptr<FlightSqlBulkLoader> bulk_loader_;
+
+  /// Hands the prepared statement back to the connection cache, closing the
+  /// handles that do not fit.
+  void ReleasePreparedStatement();
+
+  /// Prepares on the server the query whose preparation was deferred, if any.
+  void CompleteDeferredPrepare();
+
+  /// Whether `query` runs as an update, as set by the EXECUTE_MODE attribute.
+  bool RunsAsUpdate(const std::string &query);
+
+  /// Makes the row count reported by an update current.
+  void SetUpdateResult(const Result<int64_t> &result);
+
+  /// Keeps the results of earlier queries from being reused, after a
+  /// statement that may change them.
+  void InvalidateSharedResults();
+
+  /// Closes the prepared statements cached by the connection, unless
+  /// `statement`, which was just executed, only changed table rows.
+  void InvalidatePreparedStatements(const std::string &statement);
+
+  /// Makes Interrupt stop the waits of `reader`, interrupting it right away
+  /// when this statement is interrupted already.
+  void WatchSharedReader(const std::shared_ptr<CoalescedQuery::Reader> &reader);
+
+  /// Makes the results of a query shared with other statements current.
+  void SetSharedResult(std::shared_ptr<CoalescedQuery::Reader> reader);
+
+  /// Makes a result kept by the result cache current.
+  void SetCachedResult(const CachedResult &cached);
+
+  /// Executes a single statement and makes its results current.
+  /// \return whether the statement has a result set.
+  bool ExecuteStatement(const std::string &query);
+
+  /// Makes the results of the current statement of the batch current, and
+  /// starts executing the next one when it can run while they stream.
+  /// \return whether the statement has a result set.
+  bool ExecuteBatchStatement();
+
   std::shared_ptr<odbcabstraction::ResultSet>
   GetTables(const std::string *catalog_name, const std::string *schema_name,
             const std::string *table_name, const std::string *table_type,
@@ -41,8 +138,12 @@ public:
   FlightSqlStatement(
       const odbcabstraction::Diagnostics &diagnostics,
       arrow::flight::sql::FlightSqlClient &sql_client,
+      arrow::flight::FlightClient *flight_client,
       arrow::flight::FlightCallOptions call_options,
-      const odbcabstraction::MetadataSettings& metadata_settings);
+      const odbcabstraction::MetadataSettings& metadata_settings,
+      std::shared_ptr<PreparedStatementCache> prepared_statement_cache,
+      std::shared_ptr<QueryResultCache> result_cache,
+      std::shared_ptr<QueryCoalescer> query_coalescer);
 
   ~FlightSqlStatement() override;
 
@@ -53,7 +154,27 @@ public:
   boost::optional<std::shared_ptr<odbcabstraction::ResultSetMetadata>>
   Prepare(const std::string &query) override;
 
-  bool ExecutePrepared() override;
+  boost::optional<std::shared_ptr<odbcabstraction::ResultSetMetadata>>
+  DescribePrepared() override;
+
+  std::shared_ptr<odbcabstraction::ResultSetMetadata> GetParameterMetadata() override;
+
+  void BindParameter(int parameter, int16_t c_type, int16_t sql_type, int precision,
+                     int scale, void *buffer, size_t buffer_length,
+                     ssize_t *strlen_buffer) override;
+
+  bool ExecutePrepared(size_t paramset_size, size_t bind_offset, size_t bind_type,
+                       const uint16_t *operation_array) override;
+
+  void BindBulkColumn(int column, const std::string &column_name, int16_t c_type,
+                      int precision, int scale, void *buffer, size_t buffer_length,
+                      ssize_t *strlen_buffer) override;
+
+  size_t BulkAdd(const std::string *catalog_name, const std::string *schema_name,
+                 const std::string &table_name, size_t rows, size_t bind_offset,
+                 size_t bind_type, const uint16_t *operation_array) override;
+
+  void FinishBulkLoad() override;
 
   bool Execute(const std::string &query) override;
 
@@ -61,6 +182,10 @@ public:
 
   long GetUpdateCount() override;
 
+  bool NextResult() override;
+
+  void DiscardPendingResults() override;
+
   std::shared_ptr<odbcabstraction::ResultSet>
   GetTables_V2(const std::string *catalog_name, const std::string *schema_name,
                const std::string *table_name, const std::string *table_type) override;
@@ -93,6 +218,10 @@ public:
   odbcabstraction::Diagnostics &GetDiagnostics() override;
 
   void Cancel() override;
+
+  void Interrupt() override;
+
+  void ClearInterrupt() override;
 };
 } // namespace flight_sql
 } // namespace driver
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_statement_text.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace driver {
+namespace flight_sql {
+
+namespace {
+
+bool IsSpace(char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; }
+
+bool IsAlpha(char c) { return std::isalpha(static_cast<unsigned char>(c)) != 0; }
+
+bool IsIdentifierChar(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
+}
+
+/// Returns the position just past the comment, quoted text or dollar-quoted
+/// string starting at `pos`, or `pos` when none starts there. Unterminated
+/// ones run to the end of the text.
+size_t SkipQuotedTextOrComment(const std::string &sql, size_t pos) {
+  const char c = sql[pos];
+  const char next = pos + 1 < sql.size() ? sql[pos + 1] : '\0';
+
+  if (c == '-' && next == '-') {
+    size_t end = sql.find('\n', pos + 2);
+    return end == std::string::npos ? sql.size() : end + 1;
+  }
+  if (c == '/' && next == '*') {
+    size_t end = sql.find("*/", pos + 2);
+    return end == std::string::npos ? sql.size() : end + 2;
+  }
+  if (c == '\'' || c == '"' || c == '`') {
+    // E'...' strings take backslash escapes.
+    const bool escapes = c == '\'' && pos > 0 && (sql[pos - 1] == 'E' || sql[pos - 1] == 'e') &&
+                         (pos == 1 || !IsIdentifierChar(sql[pos - 2]));
+    // A doubled quote stands for itself and does not end the text.
+    for (size_t i = pos + 1; i < sql.size(); ++i) {
+      if (escapes && sql[i] == '\\') {
+        ++i;
+      } else if (sql[i] == c) {
+        if (i + 1 < sql.size() && sql[i + 1] == c) {
+          ++i;
+        } else {
+          return i + 1;
+        }
+      }
+    }
+    return sql.size();
+  }
+  if (c == '$') {
+    // $tag$ ... $tag$, where the tag may be empty. $1 is a parameter.
+    size_t tag_end = pos + 1;
+    while (tag_end < sql.size() && IsIdentifierChar(sql[tag_end])) {
+      ++tag_end;
+    }
+    if (tag_end < sql.size() && sql[tag_end] == '$' &&
+        !std::isdigit(static_cast<unsigned char>(next))) {
+      const std::string tag = sql.substr(pos, tag_end - pos + 1);
+      size_t end = sql.find(tag, tag_end + 1);
+      return end == std::string::npos ? sql.size() : end + tag.size();
+    }
+  }
+  return pos;
+}
+
+/// Whether the text has something besides whitespace and comments.
+bool HasContent(const std::string &sql) {
+  for (size_t i = 0; i < sql.size();) {
+    if (IsSpace(sql[i])) {
+      ++i;
+      continue;
+    }
+    size_t end = SkipQuotedTextOrComment(sql, i);
+    if (end == i || (sql[i] != '-' && sql[i] != '/')) {
+      return true;
+    }
+    i = end;
+  }
+  return false;
+}
+
+/// Whether `keyword` appears in the statement outside quoted text, dollar-quoted
+/// strings and comments.
+bool ContainsKeyword(const std::string &statement, const std::string &keyword) {
+  for (size_t i = 0; i < statement.size();) {
+    size_t end = SkipQuotedTextOrComment(statement, i);
+    if (end != i) {
+      i = end;
+    } else if (IsIdentifierChar(statement[i])) {
+      std::string word;
+      for (; i < statement.size() && IsIdentifierChar(statement[i]); ++i) {
+        word.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(statement[i]))));
+      }
+      if (word == keyword) {
+        return true;
+      }
+    } else {
+      ++i;
+    }
+  }
+  return false;
+}
+
+/// Reads the word starting at `*pos` in upper case, moving past it.
+std::string ReadWord(const std::string &sql, size_t *pos) {
+  std::string word;
+  for (; *pos < sql.size() && IsIdentifierChar(sql[*pos]); ++*pos) {
+    word.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(sql[*pos]))));
+  }
+  return word;
+}
+
+/// Whether the BEGIN ending at `pos` opens a block of statements, like the
+/// body of CREATE TRIGGER ... FOR EACH ROW BEGIN or CREATE PROCEDURE p() BEGIN,
+/// rather than naming a column or starting a transaction.
+bool OpensBlock(const std::string &leading_keyword, const std::string &previous_token,
+                const std::string &sql, size_t pos) {
+  while (pos < sql.size() && IsSpace(sql[pos])) {
+    ++pos;
+  }
+  if (ReadWord(sql, &pos) == "ATOMIC") {
+    return true;
+  }
+
+  static const char *const BLOCK_PREFIXES[] = {"AS", "IS", "ROW", "STATEMENT", ")"};
+  return leading_keyword == "CREATE" &&
+         std::any_of(std::begin(BLOCK_PREFIXES), std::end(BLOCK_PREFIXES),
+                     [&previous_token](const char *prefix) { return previous_token == prefix; });
+}
+
+std::string Trim(const std::string &sql) {
+  size_t begin = 0;
+  size_t end = sql.size();
+  while (begin < end && IsSpace(sql[begin])) {
+    ++begin;
+  }
+  while (end > begin && IsSpace(sql[end - 1])) {
+    --end;
+  }
+  return sql.substr(begin, end - begin);
+}
+
+} // namespace
+
+std::vector<std::string> SplitSqlStatements(const std::string &sql) {
+  std::vector<std::string> statements;
+  size_t statement_begin = 0;
+  // First word of the current statement, and its last word in upper case or
+  // punctuation character.
+  std::string leading_keyword;
+  std::string previous_token;
+  for (size_t i = 0; i <= sql.size();) {
+    if (i == sql.size() || sql[i] == ';') {
+      std::string statement = sql.substr(statement_begin, i - statement_begin);
+      if (HasContent(statement)) {
+        statements.push_back(Trim(statement));
+      }
+      statement_begin = ++i;
+      leading_keyword.clear();
+      previous_token.clear();
+      continue;
+    }
+
+    if (IsSpace(sql[i])) {
+      ++i;
+    } else if (IsIdentifierChar(sql[i])) {
+      const std::string word = ReadWord(sql, &i);
+      // The semicolons of a block end the statements inside it instead, so
+      // text with one is executed as it is.
+      if (word == "BEGIN" && !leading_keyword.empty() &&
+          OpensBlock(leading_keyword, previous_token, sql, i)) {
+        return {Trim(sql)};
+      }
+      if (leading_keyword.empty()) {
+        leading_keyword = word;
+      }
+      previous_token = word;
+    } else {
+      const size_t end = SkipQuotedTextOrComment(sql, i);
+      const bool comment = end != i && (sql[i] == '-' || sql[i] == '/');
+      if (!comment) {
+        previous_token = std::string(1, sql[i]);
+      }
+      i = end == i ? i + 1 : end;
+    }
+  }
+  return statements;
+}
+
+std::string GetLeadingKeyword(const std::string &statement) {
+  size_t i = 0;
+  while (i < statement.size()) {
+    if (IsSpace(statement[i]) || statement[i] == '(') {
+      ++i;
+    } else if ((statement[i] == '-' || statement[i] == '/') &&
+               SkipQuotedTextOrComment(statement, i) != i) {
+      i = SkipQuotedTextOrComment(statement, i);
+    } else {
+      break;
+    }
+  }
+
+  std::string keyword;
+  for (; i < statement.size() && IsAlpha(statement[i]); ++i) {
+    keyword.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(statement[i]))));
+  }
+  return keyword;
+}
+
+bool IsReadOnlyStatement(const std::string &statement) {
+  // WITH is left out since some databases accept data-modifying CTEs.
+  static const char *const READ_ONLY_KEYWORDS[] = {"SELECT", "VALUES", "SHOW", "DESCRIBE",
+                                                   "TABLE", "FROM"};
+  const std::string keyword = GetLeadingKeyword(statement);
+  return std::any_of(std::begin(READ_ONLY_KEYWORDS), std::end(READ_ONLY_KEYWORDS),
+                     [&keyword](const char *read_only) { return keyword == read_only; });
+}
+
+bool IsUpdateStatement(const std::string &statement) {
+  static const char *const UPDATE_KEYWORDS[] = {"INSERT", "UPDATE", "DELETE", "MERGE",
+                                                "CREATE", "DROP",   "ALTER",  "TRUNCATE"};
+  const std::string keyword = GetLeadingKeyword(statement);
+  return std::any_of(std::begin(UPDATE_KEYWORDS), std::end(UPDATE_KEYWORDS),
+                     [&keyword](const char *update) { return keyword == update; }) &&
+         !ContainsKeyword(statement, "RETURNING");
+}
+
+bool IsSchemaChangeStatement(const std::string &statement) {
+  // ATTACH and DETACH add or remove whole catalogs.
+  static const char *const SCHEMA_CHANGE_KEYWORDS[] = {"CREATE", "ALTER",  "DROP",
+                                                       "RENAME", "ATTACH", "DETACH"};
+  const std::string keyword = GetLeadingKeyword(statement);
+  return std::any_of(std::begin(SCHEMA_CHANGE_KEYWORDS), std::end(SCHEMA_CHANGE_KEYWORDS),
+                     [&keyword](const char *schema_change) { return keyword == schema_change; });
+}
+
+} // namespace flight_sql
+} // namespace driver
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace driver {
+namespace flight_sql {
+
+/// Splits a batch into its statements at the semicolons outside quoted text,
+/// dollar-quoted strings and comments. Statements holding nothing but
+/// whitespace or comments are dropped. Text where a CREATE statement opens a
+/// BEGIN ... END block, like CREATE TRIGGER, is returned whole.
+std::vector<std::string> SplitSqlStatements(const std::string &sql);
+
+/// Returns the first keyword of a statement in upper case, skipping leading
+/// whitespace, comments and opening parentheses. Returns an empty string when
+/// the statement does not start with a keyword.
+std::string GetLeadingKeyword(const std::string &statement);
+
+/// Whether the statement only reads data, so running other statements while
+/// its results stream cannot change them.
+bool IsReadOnlyStatement(const std::string &statement);
+
+/// Whether the statement changes data or schema objects without returning
+/// rows, so it can run as an update that only reports a row count.
+bool IsUpdateStatement(const std::string &statement);
+
+/// Whether the statement creates, changes or removes schema objects, which
+/// prepared statements may have been planned against.
+bool IsSchemaChangeStatement(const std::string &statement);
+
+} // namespace flight_sql
+} // namespace driver
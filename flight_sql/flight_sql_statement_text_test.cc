@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include "flight_sql_statement_text.h"
+#include "gtest/gtest.h"
+
+namespace driver {
+namespace flight_sql {
+
+typedef std::vector<std::string> Statements;
+
+TEST(StatementText, SplitsAtSemicolons) {
+  ASSERT_EQ(Statements({"CREATE TABLE t (a INT)", "INSERT INTO t VALUES (1)", "SELECT * FROM t"}),
+            SplitSqlStatements("CREATE TABLE t (a INT);\n INSERT INTO t VALUES (1) ;SELECT * FROM t;"));
+  ASSERT_EQ(Statements({"SELECT 1"}), SplitSqlStatements("SELECT 1"));
+}
+
+TEST(StatementText, KeepsSemicolonsInQuotedTextAndComments) {
+  ASSERT_EQ(Statements({"SELECT 'a;''b'", "SELECT \"c;d\""}),
+            SplitSqlStatements("SELECT 'a;''b'; SELECT \"c;d\""));
+  ASSERT_EQ(Statements({"SELECT 1 -- one; two", "SELECT /* ; */ 2"}),
+            SplitSqlStatements("SELECT 1 -- one; two\n; SELECT /* ; */ 2"));
+  ASSERT_EQ(Statements({"CREATE FUNCTION f() AS $body$ SELECT 1; $body$", "SELECT $1"}),
+            SplitSqlStatements("CREATE FUNCTION f() AS $body$ SELECT 1; $body$; SELECT $1"));
+}
+
+TEST(StatementText, KeepsBlocksWhole) {
+  const std::string trigger =
+      "CREATE TRIGGER t_audit AFTER INSERT ON t FOR EACH ROW BEGIN\n"
+      "  INSERT INTO audit VALUES (1);\n"
+      "  UPDATE counts SET n = n + 1;\n"
+      "END;";
+  ASSERT_EQ(Statements({trigger}), SplitSqlStatements(trigger + "\n"));
+  ASSERT_EQ(Statements({"BEGIN TRANSACTION", "INSERT INTO t VALUES (1)", "COMMIT"}),
+            SplitSqlStatements("BEGIN TRANSACTION; INSERT INTO t VALUES (1); COMMIT"));
+  ASSERT_EQ(Statements({"SELECT begin_date FROM t", "SELECT 'begin'"}),
+            SplitSqlStatements("SELECT begin_date FROM t; SELECT 'begin'"));
+  ASSERT_EQ(Statements({"SELECT begin FROM t", "SELECT 2"}),
+            SplitSqlStatements("SELECT begin FROM t; SELECT 2"));
+  ASSERT_EQ(Statements({"CREATE TABLE t (a INT, begin INT)", "SELECT 2"}),
+            SplitSqlStatements("CREATE TABLE t (a INT, begin INT); SELECT 2"));
+
+  const std::string procedure = "CREATE PROCEDURE p() BEGIN SELECT 1; SELECT 2; END";
+  ASSERT_EQ(Statements({procedure}), SplitSqlStatements(procedure));
+  const std::string function =
+      "CREATE FUNCTION f() RETURNS INT LANGUAGE SQL BEGIN ATOMIC SELECT 1; END";
+  ASSERT_EQ(Statements({function}), SplitSqlStatements(function));
+}
+
+TEST(StatementText, HonoursBackslashEscapesInEscapeStrings) {
+  ASSERT_EQ(Statements({"SELECT E'a\\';b'", "SELECT 2"}),
+            SplitSqlStatements("SELECT E'a\\';b'; SELECT 2"));
+  // Other strings end at the first quote, backslash or not.
+  ASSERT_EQ(Statements({"SELECT 'a\\'", "SELECT 2"}),
+            SplitSqlStatements("SELECT 'a\\'; SELECT 2"));
+  ASSERT_EQ(Statements({"SELECT name'a\\'", "SELECT 2"}),
+            SplitSqlStatements("SELECT name'a\\'; SELECT 2"));
+}
+
+TEST(StatementText, DropsEmptyStatements) {
+  ASSERT_EQ(Statements({"SELECT 1", "SELECT 2"}),
+            SplitSqlStatements(";SELECT 1;; ;SELECT 2; -- done\n"));
+  ASSERT_TRUE(SplitSqlStatements(" /* nothing */ ").empty());
+}
+
+TEST(StatementText, ReadsLeadingKeyword) {
+  ASSERT_EQ("SELECT", GetLeadingKeyword("  -- comment\n (select 1)"));
+  ASSERT_EQ("INSERT", GetLeadingKeyword("/* hint */ Insert INTO t VALUES (1)"));
+  ASSERT_EQ("", GetLeadingKeyword("'text'"));
+}
+
+TEST(StatementText, DetectsReadOnlyStatements) {
+  ASSERT_TRUE(IsReadOnlyStatement("SELECT * FROM t"));
+  ASSERT_TRUE(IsReadOnlyStatement("(VALUES (1))"));
+  ASSERT_FALSE(IsReadOnlyStatement("WITH d AS (DELETE FROM t RETURNING *) SELECT * FROM d"));
+  ASSERT_FALSE(IsReadOnlyStatement("UPDATE t SET a = 1"));
+}
+
+TEST(StatementText, DetectsUpdateStatements) {
+  ASSERT_TRUE(IsUpdateStatement("insert into t values (1)"));
+  ASSERT_TRUE(IsUpdateStatement("/* migration */ CREATE TABLE t AS SELECT 1 AS a"));
+  ASSERT_TRUE(IsUpdateStatement("DELETE FROM t WHERE note = 'returning'"));
+  ASSERT_FALSE(IsUpdateStatement("INSERT INTO t VALUES (1) RETURNING a"));
+  ASSERT_FALSE(IsUpdateStatement("WITH d AS (SELECT 1) INSERT INTO t SELECT * FROM d"));
+  ASSERT_FALSE(IsUpdateStatement("SELECT 1"));
+}
+
+TEST(StatementText, DetectsSchemaChangeStatements) {
+  ASSERT_TRUE(IsSchemaChangeStatement("ALTER TABLE t ADD COLUMN b INT"));
+  ASSERT_TRUE(IsSchemaChangeStatement("-- cleanup\ndrop view v"));
+  ASSERT_TRUE(IsSchemaChangeStatement("ATTACH 'other.db' AS other"));
+  ASSERT_FALSE(IsSchemaChangeStatement("INSERT INTO t VALUES (1) RETURNING a"));
+  ASSERT_FALSE(IsSchemaChangeStatement("WITH d AS (SELECT 1) SELECT * FROM d"));
+  ASSERT_FALSE(IsSchemaChangeStatement("SET threads = 4"));
+  ASSERT_FALSE(IsSchemaChangeStatement("EXPLAIN SELECT 1"));
+  ASSERT_FALSE(IsSchemaChangeStatement("CALL refresh()"));
+}
+
+} // namespace flight_sql
+} // namespace driver
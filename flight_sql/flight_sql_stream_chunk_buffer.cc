@@ -18,34 +18,103 @@ FlightStreamChunkBuffer::FlightStreamChunkBuffer(FlightSqlClient &flight_sql_cli
                                                  const arrow::flight::FlightCallOptions &call_options,
                                                  const std::shared_ptr<FlightInfo> &flight_info,
                                                  size_t queue_capacity,
-                                                 bool use_extended_flightsql_buffer): queue_(queue_capacity, use_extended_flightsql_buffer) {
+                                                 bool use_extended_flightsql_buffer,
+                                                 std::shared_ptr<FlightInfoPoller> poller,
+                                                 std::shared_ptr<ResultRecorder> recorder)
+    : queue_(queue_capacity, use_extended_flightsql_buffer), poller_(std::move(poller)),
+      recorder_(std::move(recorder)) {
 
   // FIXME: Endpoint iteration should consider endpoints may be at different hosts
   for (const auto & endpoint : flight_info->endpoints()) {
-    const arrow::flight::Ticket &ticket = endpoint.ticket;
+    AddEndpoint(flight_sql_client, call_options, endpoint);
+  }
 
-    auto result = flight_sql_client.DoGet(call_options, ticket);
-    ThrowIfNotOK(result.status());
-    std::shared_ptr<FlightStreamReader> stream_reader_ptr(std::move(result.ValueOrDie()));
+  if (poller_) {
+    // The stream must not end while the query may still publish endpoints.
+    queue_.Hold();
+    poll_thread_ = std::thread([this, &flight_sql_client, call_options] {
+      try {
+        std::vector<FlightEndpoint> endpoints;
+        while (poller_->Next(&endpoints)) {
+          for (const auto &endpoint : endpoints) {
+            AddEndpoint(flight_sql_client, call_options, endpoint);
+          }
+        }
+      } catch (const std::exception &e) {
+        // Hand the failure to the consumer like a failed stream.
+        arrow::Status status = arrow::Status::IOError(e.what());
+        bool reported = false;
+        queue_.AddProducer([status, reported]() mutable {
+          boost::optional<Result<FlightStreamChunk>> item;
+          if (!reported) {
+            item = Result<FlightStreamChunk>(status);
+            reported = true;
+          }
+          return item;
+        });
+      }
+      queue_.ReleaseHold();
+    });
+  }
+}
 
-    // Keep a reference so Close() can cancel the gRPC streams before
-    // joining producer threads (prevents hang on unconsumed DDL/DML results).
-    stream_readers_.push_back(stream_reader_ptr);
+FlightStreamChunkBuffer::FlightStreamChunkBuffer(RecordBatchSource source)
+    : queue_(1, false), source_(std::make_shared<RecordBatchSource>(std::move(source))) {}
 
-    BlockingQueue<Result<FlightStreamChunk>>::Supplier supplier = [=] {
-      auto result = stream_reader_ptr->Next();
-      bool isNotOk = !result.ok();
-      bool isNotEmpty = result.ok() && (result.ValueOrDie().data != nullptr);
+void FlightStreamChunkBuffer::AddEndpoint(FlightSqlClient &flight_sql_client,
+                                          const arrow::flight::FlightCallOptions &call_options,
+                                          const FlightEndpoint &endpoint) {
+  const arrow::flight::Ticket &ticket = endpoint.ticket;
 
-      return boost::make_optional(isNotOk || isNotEmpty, std::move(result));
-    };
-    queue_.AddProducer(std::move(supplier));
+  auto result = flight_sql_client.DoGet(call_options, ticket);
+  ThrowIfNotOK(result.status());
+  std::shared_ptr<FlightStreamReader> stream_reader_ptr(std::move(result.ValueOrDie()));
+
+  // Keep a reference so Close() can cancel the gRPC streams before
+  // joining producer threads (prevents hang on unconsumed DDL/DML results).
+  {
+    std::unique_lock<std::mutex> lock(stream_readers_mutex_);
+    if (closed_) {
+      stream_reader_ptr->Cancel();
+      return;
+    }
+    stream_readers_.push_back(stream_reader_ptr);
   }
+
+  BlockingQueue<Result<FlightStreamChunk>>::Supplier supplier = [=] {
+    auto result = stream_reader_ptr->Next();
+    bool isNotOk = !result.ok();
+    bool isNotEmpty = result.ok() && (result.ValueOrDie().data != nullptr);
+
+    return boost::make_optional(isNotOk || isNotEmpty, std::move(result));
+  };
+  queue_.AddProducer(std::move(supplier));
 }
 
 bool FlightStreamChunkBuffer::GetNext(FlightStreamChunk *chunk) {
+  std::shared_ptr<RecordBatchSource> source;
+  {
+    std::unique_lock<std::mutex> lock(stream_readers_mutex_);
+    source = source_;
+  }
+  if (source) {
+    chunk->data.reset();
+    return (*source)(&chunk->data);
+  }
+
   Result<FlightStreamChunk> result;
   if (!queue_.Pop(&result)) {
+    std::shared_ptr<ResultRecorder> recorder;
+    {
+      std::unique_lock<std::mutex> lock(stream_readers_mutex_);
+      // A closed buffer stopped before the end of the result.
+      if (!closed_) {
+        recorder = std::move(recorder_);
+      }
+    }
+    if (recorder) {
+      recorder->Finish();
+    }
     return false;
   }
 
@@ -54,14 +123,36 @@ bool FlightStreamChunkBuffer::GetNext(FlightStreamChunk *chunk) {
     throw odbcabstraction::DriverException(result.status().message());
   }
   *chunk = std::move(result.ValueOrDie());
+  if (chunk->data) {
+    std::shared_ptr<ResultRecorder> recorder;
+    {
+      std::unique_lock<std::mutex> lock(stream_readers_mutex_);
+      recorder = recorder_;
+    }
+    if (recorder) {
+      recorder->Add(chunk->data);
+    }
+  }
   return chunk->data != nullptr;
 }
 
 void FlightStreamChunkBuffer::Close() {
   // Cancel all gRPC streams first so producer threads blocked in Next()
   // will unblock, allowing the queue's thread join to complete promptly.
-  for (auto &reader : stream_readers_) {
-    reader->Cancel();
+  {
+    std::unique_lock<std::mutex> lock(stream_readers_mutex_);
+    closed_ = true;
+    recorder_.reset();
+    source_ = nullptr;
+    for (auto &reader : stream_readers_) {
+      reader->Cancel();
+    }
+  }
+  if (poller_) {
+    poller_->Stop();
+  }
+  if (poll_thread_.joinable()) {
+    poll_thread_.join();
   }
   queue_.Close();
 }
@@ -11,6 +11,13 @@
 #include <arrow/flight/sql/client.h>
 #include <odbcabstraction/blocking_queue.h>
 
+#include "flight_sql_flight_info_poller.h"
+#include "flight_sql_result_cache.h"
+
+#include <functional>
+#include <mutex>
+#include <thread>
+
 
 namespace driver {
 namespace flight_sql {
@@ -22,16 +29,41 @@ using arrow::flight::FlightStreamReader;
 using arrow::flight::sql::FlightSqlClient;
 using driver::odbcabstraction::BlockingQueue;
 
+/// Produces the batches of a result one at a time.
+/// \return false once every batch was returned.
+typedef std::function<bool(std::shared_ptr<arrow::RecordBatch> *batch)> RecordBatchSource;
+
 class FlightStreamChunkBuffer {
   BlockingQueue<Result<FlightStreamChunk>> queue_;
+  std::mutex stream_readers_mutex_;
   std::vector<std::shared_ptr<FlightStreamReader>> stream_readers_;
+  bool closed_ = false;
+  std::shared_ptr<FlightInfoPoller> poller_;
+  std::thread poll_thread_;
+  std::shared_ptr<ResultRecorder> recorder_;
+  // Produces the batches in place of a stream, when set. Guarded by
+  // stream_readers_mutex_, since Close may reset it from another thread.
+  std::shared_ptr<RecordBatchSource> source_;
+
+  void AddEndpoint(FlightSqlClient &flight_sql_client,
+                   const arrow::flight::FlightCallOptions &call_options,
+                   const arrow::flight::FlightEndpoint &endpoint);
 
 public:
+  /// When `poller` is set, the endpoints it reports after those of
+  /// `flight_info` are read as soon as the server publishes them. When
+  /// `recorder` is set, it gets every batch and is finished once the whole
+  /// result was read.
   FlightStreamChunkBuffer(FlightSqlClient &flight_sql_client,
                           const arrow::flight::FlightCallOptions &call_options,
                           const std::shared_ptr<FlightInfo> &flight_info,
                           size_t queue_capacity = 5,
-                          bool use_extended_flightsql_buffer = false);
+                          bool use_extended_flightsql_buffer = false,
+                          std::shared_ptr<FlightInfoPoller> poller = nullptr,
+                          std::shared_ptr<ResultRecorder> recorder = nullptr);
+
+  /// Returns the batches `source` produces, without a server call of its own.
+  explicit FlightStreamChunkBuffer(RecordBatchSource source);
 
   ~FlightStreamChunkBuffer();
 
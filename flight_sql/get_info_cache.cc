@@ -1189,7 +1189,7 @@ void GetInfoCache::LoadDefaultsForMissingEntries() {
   SetDefaultIfMissing(info_, SQL_DDL_INDEX, static_cast<uint32_t>(0));
   SetDefaultIfMissing(info_, SQL_DEFAULT_TXN_ISOLATION,
                       static_cast<uint32_t>(0));
-  SetDefaultIfMissing(info_, SQL_DESCRIBE_PARAMETER, "N");
+  SetDefaultIfMissing(info_, SQL_DESCRIBE_PARAMETER, "Y");
   SetDefaultIfMissing(info_, SQL_DRIVER_NAME, "GizmoSQL ODBC Driver");
   SetDefaultIfMissing(info_, SQL_DRIVER_ODBC_VER, "03.80");
   SetDefaultIfMissing(info_, SQL_DRIVER_VER, "00.09.0000");
@@ -1266,6 +1266,11 @@ void GetInfoCache::LoadDefaultsForMissingEntries() {
       info_, SQL_OJ_CAPABILITIES,
       static_cast<uint32_t>(SQL_OJ_LEFT | SQL_OJ_RIGHT | SQL_OJ_FULL));
   SetDefaultIfMissing(info_, SQL_ORDER_BY_COLUMNS_IN_SELECT, "Y");
+  // Parameter arrays go to the server as one batch with a single outcome.
+  SetDefaultIfMissing(info_, SQL_PARAM_ARRAY_ROW_COUNTS,
+                      static_cast<uint32_t>(SQL_PARC_NO_BATCH));
+  SetDefaultIfMissing(info_, SQL_PARAM_ARRAY_SELECTS,
+                      static_cast<uint32_t>(SQL_PAS_NO_BATCH));
   SetDefaultIfMissing(info_, SQL_PROCEDURE_TERM, "");
   SetDefaultIfMissing(info_, SQL_PROCEDURES, "N");
   SetDefaultIfMissing(info_, SQL_QUOTED_IDENTIFIER_CASE,
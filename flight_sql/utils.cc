@@ -7,7 +7,6 @@
 
 #include "utils.h"
 
-#include <odbcabstraction/calendar_utils.h>
 #include <odbcabstraction/encoding.h>
 #include <odbcabstraction/types.h>
 #include <odbcabstraction/platform.h>
@@ -17,11 +16,15 @@
 #include <arrow/type_fwd.h>
 #include <arrow/compute/api.h>
 #include <arrow/compute/initialize.h>
+#include <arrow/extension_type.h>
+#include <arrow/util/checked_cast.h>
 
 #include "json_converter.h"
 
 #include <boost/tokenizer.hpp>
 
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <ctime>
 
@@ -52,6 +55,127 @@ odbcabstraction::CDataType GetDefaultCCharType(bool useWideChar) {
   return useWideChar ? odbcabstraction::CDataType_WCHAR : odbcabstraction::CDataType_CHAR;
 }
 
+constexpr int64_t NANOS_PER_SECOND = 1000000000;
+constexpr int64_t NANOS_PER_MINUTE = 60 * NANOS_PER_SECOND;
+constexpr int64_t NANOS_PER_HOUR = 60 * NANOS_PER_MINUTE;
+constexpr int64_t NANOS_PER_DAY = 24 * NANOS_PER_HOUR;
+
+// Enough for "-2147483648 months -2147483648 23:59:59.999999999".
+constexpr size_t MAX_INTERVAL_TEXT_LENGTH = 64;
+
+const char UUID_EXTENSION_NAME[] = "arrow.uuid";
+
+char *WriteDigits(char *out, uint64_t value) {
+  char digits[20];
+  int count = 0;
+  do {
+    digits[count++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  while (count > 0) {
+    *out++ = digits[--count];
+  }
+  return out;
+}
+
+char *WriteTwoDigits(char *out, int64_t value) {
+  *out++ = static_cast<char>('0' + value / 10);
+  *out++ = static_cast<char>('0' + value % 10);
+  return out;
+}
+
+char *WriteSigned(char *out, int64_t value) {
+  if (value < 0) {
+    *out++ = '-';
+  }
+  return WriteDigits(out, static_cast<uint64_t>(std::abs(value)));
+}
+
+/// Writes "[-]D HH:MM:SS[.fffffffff]", dropping trailing zeros of the fraction.
+char *WriteDayTimeInterval(char *out, int64_t days, int64_t nanoseconds) {
+  NormalizeDayTimeInterval(days, nanoseconds);
+  if (days < 0 || nanoseconds < 0) {
+    *out++ = '-';
+  }
+  const int64_t abs_nanos = std::abs(nanoseconds);
+  out = WriteDigits(out, static_cast<uint64_t>(std::abs(days)));
+  *out++ = ' ';
+  out = WriteTwoDigits(out, abs_nanos / NANOS_PER_HOUR);
+  *out++ = ':';
+  out = WriteTwoDigits(out, abs_nanos / NANOS_PER_MINUTE % 60);
+  *out++ = ':';
+  out = WriteTwoDigits(out, abs_nanos / NANOS_PER_SECOND % 60);
+
+  int64_t fraction = abs_nanos % NANOS_PER_SECOND;
+  if (fraction != 0) {
+    int fraction_digits = 9;
+    for (; fraction % 10 == 0; fraction /= 10) {
+      --fraction_digits;
+    }
+    *out++ = '.';
+    for (int i = fraction_digits - 1; i >= 0; --i, fraction /= 10) {
+      out[i] = static_cast<char>('0' + fraction % 10);
+    }
+    out += fraction_digits;
+  }
+  return out;
+}
+
+/// Formats every value of an interval array with \p write, which receives a
+/// buffer of MAX_INTERVAL_TEXT_LENGTH bytes and returns the end of the text.
+template <typename ARRAY_TYPE, typename WRITE>
+std::shared_ptr<arrow::Array> FormatIntervals(const arrow::Array &array, WRITE write) {
+  const auto &intervals = arrow::internal::checked_cast<const ARRAY_TYPE &>(array);
+  const int64_t length = intervals.length();
+
+  arrow::StringBuilder builder;
+  ThrowIfNotOK(builder.Reserve(length));
+  char text[MAX_INTERVAL_TEXT_LENGTH];
+  for (int64_t i = 0; i < length; ++i) {
+    if (intervals.IsNull(i)) {
+      ThrowIfNotOK(builder.AppendNull());
+    } else {
+      const char *end = write(text, intervals, i);
+      ThrowIfNotOK(builder.Append(text, static_cast<int32_t>(end - text)));
+    }
+  }
+
+  auto finish = builder.Finish();
+  return finish.ValueOrDie();
+}
+
+/// Formats year-month intervals as the month count and day-time intervals as
+/// "[-]D HH:MM:SS[.fffffffff]". A month-day-nano value with months is
+/// prefixed with "[-]M months ".
+std::shared_ptr<arrow::Array> FormatIntervalArray(const arrow::Array &array) {
+  switch (array.type_id()) {
+    case arrow::Type::INTERVAL_MONTHS:
+      return FormatIntervals<arrow::MonthIntervalArray>(
+          array, [](char *out, const arrow::MonthIntervalArray &intervals, int64_t i) {
+            return WriteSigned(out, intervals.Value(i));
+          });
+    case arrow::Type::INTERVAL_DAY_TIME:
+      return FormatIntervals<arrow::DayTimeIntervalArray>(
+          array, [](char *out, const arrow::DayTimeIntervalArray &intervals, int64_t i) {
+            const auto value = intervals.GetValue(i);
+            return WriteDayTimeInterval(out, value.days,
+                                        static_cast<int64_t>(value.milliseconds) * 1000000);
+          });
+    default:
+      return FormatIntervals<arrow::MonthDayNanoIntervalArray>(
+          array, [](char *out, const arrow::MonthDayNanoIntervalArray &intervals, int64_t i) {
+            const auto value = intervals.GetValue(i);
+            if (value.months != 0) {
+              out = WriteSigned(out, value.months);
+              static const char MONTHS[] = " months ";
+              std::memcpy(out, MONTHS, sizeof(MONTHS) - 1);
+              out += sizeof(MONTHS) - 1;
+            }
+            return WriteDayTimeInterval(out, value.days, value.nanoseconds);
+          });
+  }
+}
+
 }
 
 using namespace odbcabstraction;
@@ -107,17 +231,21 @@ GetDataTypeFromArrowField_V3(const std::shared_ptr<arrow::Field> &field, bool us
   case arrow::Type::INTERVAL_MONTHS:
     return odbcabstraction::SqlDataType_INTERVAL_MONTH; // TODO: maybe SqlDataType_INTERVAL_YEAR_TO_MONTH
   case arrow::Type::INTERVAL_DAY_TIME:
-    return odbcabstraction::SqlDataType_INTERVAL_DAY;
+  case arrow::Type::INTERVAL_MONTH_DAY_NANO:
+    return odbcabstraction::SqlDataType_INTERVAL_DAY_TO_SECOND;
+  case arrow::Type::EXTENSION:
+    if (IsUuidType(*type)) {
+      return odbcabstraction::SqlDataType_GUID;
+    }
+    break;
 
   // TODO: Handle remaining types.
-  case arrow::Type::INTERVAL_MONTH_DAY_NANO:
   case arrow::Type::LIST:
   case arrow::Type::STRUCT:
   case arrow::Type::SPARSE_UNION:
   case arrow::Type::DENSE_UNION:
   case arrow::Type::DICTIONARY:
   case arrow::Type::MAP:
-  case arrow::Type::EXTENSION:
   case arrow::Type::FIXED_SIZE_LIST:
   case arrow::Type::DURATION:
   case arrow::Type::LARGE_LIST:
@@ -698,6 +826,76 @@ boost::xpressive::sregex ConvertSqlPatternToRegex(const std::string &pattern) {
   return boost::xpressive::sregex(boost::xpressive::sregex::compile(regex_str));
 }
 
+bool IsNumericArrowType(arrow::Type::type type_id) {
+  switch (type_id) {
+    case arrow::Type::INT8:
+    case arrow::Type::UINT8:
+    case arrow::Type::INT16:
+    case arrow::Type::UINT16:
+    case arrow::Type::INT32:
+    case arrow::Type::UINT32:
+    case arrow::Type::INT64:
+    case arrow::Type::UINT64:
+    case arrow::Type::FLOAT:
+    case arrow::Type::DOUBLE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsNumericCDataType(odbcabstraction::CDataType data_type) {
+  switch (data_type) {
+    case odbcabstraction::CDataType_STINYINT:
+    case odbcabstraction::CDataType_UTINYINT:
+    case odbcabstraction::CDataType_SSHORT:
+    case odbcabstraction::CDataType_USHORT:
+    case odbcabstraction::CDataType_SLONG:
+    case odbcabstraction::CDataType_ULONG:
+    case odbcabstraction::CDataType_SBIGINT:
+    case odbcabstraction::CDataType_UBIGINT:
+    case odbcabstraction::CDataType_FLOAT:
+    case odbcabstraction::CDataType_DOUBLE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsIntervalArrowType(arrow::Type::type type_id) {
+  switch (type_id) {
+    case arrow::Type::INTERVAL_MONTHS:
+    case arrow::Type::INTERVAL_DAY_TIME:
+    case arrow::Type::INTERVAL_MONTH_DAY_NANO:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsIntervalCDataType(odbcabstraction::CDataType data_type) {
+  return data_type >= odbcabstraction::CDataType_INTERVAL_YEAR &&
+         data_type <= odbcabstraction::CDataType_INTERVAL_MINUTE_TO_SECOND;
+}
+
+void NormalizeDayTimeInterval(int64_t &days, int64_t &nanoseconds) {
+  days += nanoseconds / NANOS_PER_DAY;
+  nanoseconds %= NANOS_PER_DAY;
+  if (days > 0 && nanoseconds < 0) {
+    --days;
+    nanoseconds += NANOS_PER_DAY;
+  } else if (days < 0 && nanoseconds > 0) {
+    ++days;
+    nanoseconds -= NANOS_PER_DAY;
+  }
+}
+
+bool IsUuidType(const arrow::DataType &type) {
+  return type.id() == arrow::Type::EXTENSION &&
+         arrow::internal::checked_cast<const arrow::ExtensionType &>(type).extension_name() ==
+             UUID_EXTENSION_NAME;
+}
+
 bool NeedArrayConversion(arrow::Type::type original_type_id, odbcabstraction::CDataType data_type) {
   switch (original_type_id) {
     case arrow::Type::DATE32:
@@ -705,38 +903,51 @@ bool NeedArrayConversion(arrow::Type::type original_type_id, odbcabstraction::CD
       return data_type != odbcabstraction::CDataType_DATE;
     case arrow::Type::TIME32:
     case arrow::Type::TIME64:
-      return data_type != odbcabstraction::CDataType_TIME;
+      // TIMESTAMP targets are dated today by the time accessor itself.
+      return data_type != odbcabstraction::CDataType_TIME &&
+             data_type != odbcabstraction::CDataType_TIMESTAMP;
     case arrow::Type::TIMESTAMP:
       return data_type != odbcabstraction::CDataType_TIMESTAMP;
     case arrow::Type::STRING:
+      // Temporal values sent as text are parsed by the accessor itself.
       return data_type != odbcabstraction::CDataType_CHAR &&
-             data_type != odbcabstraction::CDataType_WCHAR;
+             data_type != odbcabstraction::CDataType_WCHAR &&
+             data_type != odbcabstraction::CDataType_DATE &&
+             data_type != odbcabstraction::CDataType_TIME &&
+             data_type != odbcabstraction::CDataType_TIMESTAMP;
+    case arrow::Type::INT8:
+    case arrow::Type::UINT8:
     case arrow::Type::INT16:
-      return data_type != odbcabstraction::CDataType_SSHORT;
     case arrow::Type::UINT16:
-      return data_type != odbcabstraction::CDataType_USHORT;
     case arrow::Type::INT32:
-      return data_type != odbcabstraction::CDataType_SLONG;
     case arrow::Type::UINT32:
-      return data_type != odbcabstraction::CDataType_ULONG;
+    case arrow::Type::INT64:
+    case arrow::Type::UINT64:
     case arrow::Type::FLOAT:
-      return data_type != odbcabstraction::CDataType_FLOAT;
     case arrow::Type::DOUBLE:
-      return data_type != odbcabstraction::CDataType_DOUBLE;
+      // Numeric accessors convert between numeric C types themselves.
+      return !IsNumericCDataType(data_type);
     case arrow::Type::BOOL:
       return data_type != odbcabstraction::CDataType_BIT;
-    case arrow::Type::INT8:
-      return data_type != odbcabstraction::CDataType_STINYINT;
-    case arrow::Type::UINT8:
-      return data_type != odbcabstraction::CDataType_UTINYINT;
-    case arrow::Type::INT64:
-      return data_type != odbcabstraction::CDataType_SBIGINT;
-    case arrow::Type::UINT64:
-      return data_type != odbcabstraction::CDataType_UBIGINT;
     case arrow::Type::BINARY:
-      return data_type != odbcabstraction::CDataType_BINARY;
+      // Character targets get hex text from the binary accessor itself.
+      return data_type != odbcabstraction::CDataType_BINARY &&
+             data_type != odbcabstraction::CDataType_CHAR &&
+             data_type != odbcabstraction::CDataType_WCHAR;
+    case arrow::Type::FIXED_SIZE_BINARY:
+    case arrow::Type::EXTENSION:
+      // Fixed-width binary and UUID accessors serve these targets themselves.
+      // Other extension types are rejected when their accessor is created.
+      return data_type != odbcabstraction::CDataType_BINARY &&
+             data_type != odbcabstraction::CDataType_GUID &&
+             data_type != odbcabstraction::CDataType_CHAR &&
+             data_type != odbcabstraction::CDataType_WCHAR;
     case arrow::Type::DECIMAL128:
       return data_type != odbcabstraction::CDataType_NUMERIC;
+    case arrow::Type::INTERVAL_MONTHS:
+    case arrow::Type::INTERVAL_DAY_TIME:
+    case arrow::Type::INTERVAL_MONTH_DAY_NANO:
+      return !IsIntervalCDataType(data_type);
     case arrow::Type::LIST:
     case arrow::Type::LARGE_LIST:
     case arrow::Type::FIXED_SIZE_LIST:
@@ -860,6 +1071,7 @@ odbcabstraction::CDataType ConvertArrowTypeToC(arrow::Type::type type_id, bool u
     case arrow::Type::UINT64:
       return odbcabstraction::CDataType_UBIGINT;
     case arrow::Type::BINARY:
+    case arrow::Type::FIXED_SIZE_BINARY:
       return odbcabstraction::CDataType_BINARY;
     case arrow::Type::DECIMAL128:
       return odbcabstraction::CDataType_NUMERIC;
@@ -871,11 +1083,23 @@ odbcabstraction::CDataType ConvertArrowTypeToC(arrow::Type::type type_id, bool u
       return odbcabstraction::CDataType_TIME;
     case arrow::Type::TIMESTAMP:
       return odbcabstraction::CDataType_TIMESTAMP;
+    case arrow::Type::INTERVAL_MONTHS:
+      return odbcabstraction::CDataType_INTERVAL_MONTH;
+    case arrow::Type::INTERVAL_DAY_TIME:
+    case arrow::Type::INTERVAL_MONTH_DAY_NANO:
+      return odbcabstraction::CDataType_INTERVAL_DAY_TO_SECOND;
     default:
       throw odbcabstraction::DriverException(std::string("Invalid type id: ") + std::to_string(type_id));
   }
 }
 
+odbcabstraction::CDataType ConvertArrowTypeToC(const arrow::DataType &type, bool useWideChar) {
+  if (IsUuidType(type)) {
+    return odbcabstraction::CDataType_GUID;
+  }
+  return ConvertArrowTypeToC(type.id(), useWideChar);
+}
+
 std::shared_ptr<arrow::Array>
 CheckConversion(const arrow::Result<arrow::Datum> &result) {
   if (result.ok()) {
@@ -888,7 +1112,7 @@ CheckConversion(const arrow::Result<arrow::Datum> &result) {
 
 ArrayConvertTask GetConverter(arrow::Type::type original_type_id,
                               odbcabstraction::CDataType target_type) {
-  // Arrow 23 requires explicit initialization of compute kernels (strptime, add, cast, etc.)
+  // Arrow 23 requires explicit initialization of compute kernels (cast, etc.)
   static auto compute_init = arrow::compute::Initialize();
   ThrowIfNotOK(compute_init);
 
@@ -896,85 +1120,9 @@ ArrayConvertTask GetConverter(arrow::Type::type original_type_id,
   // conversion. In case, we find conversion that the default one can't handle
   // we can include some additional if-else statement with the logic to handle
   // it
-  if (original_type_id == arrow::Type::STRING &&
-      target_type == odbcabstraction::CDataType_TIME) {
-    return [=](const std::shared_ptr<arrow::Array> &original_array) {
-      arrow::compute::StrptimeOptions options("%H:%M", arrow::TimeUnit::MICRO);
-
-      auto converted_result =
-        arrow::compute::Strptime({original_array}, options);
-      auto first_converted_array = CheckConversion(converted_result);
-
-      arrow::compute::CastOptions cast_options;
-      cast_options.to_type = time64(arrow::TimeUnit::MICRO);
-      return CheckConversion(arrow::compute::CallFunction(
-        "cast", {first_converted_array}, &cast_options));
-    };
-  } else if (original_type_id == arrow::Type::TIME32 &&
-             target_type == odbcabstraction::CDataType_TIMESTAMP) {
-    return [=](const std::shared_ptr<arrow::Array> &original_array) {
-      arrow::compute::CastOptions cast_options;
-      cast_options.to_type = arrow::int32();
-
-      auto first_converted_array = CheckConversion(
-        arrow::compute::Cast(original_array, cast_options));
-
-      cast_options.to_type = arrow::int64();
-
-      auto second_converted_array = CheckConversion(
-        arrow::compute::Cast(first_converted_array, cast_options));
-
-      auto seconds_from_epoch = GetTodayTimeFromEpoch();
-
-      auto third_converted_array = CheckConversion(
-        arrow::compute::Add(second_converted_array, std::make_shared<arrow::Int64Scalar>(seconds_from_epoch * 1000)));
-
-      arrow::compute::CastOptions cast_options_2;
-      cast_options_2.to_type = arrow::timestamp(arrow::TimeUnit::MILLI);
-
-      return CheckConversion(
-        arrow::compute::Cast(third_converted_array, cast_options_2));
-    };
-  } else if (original_type_id == arrow::Type::TIME64 &&
-             target_type == odbcabstraction::CDataType_TIMESTAMP) {
-    return [=](const std::shared_ptr<arrow::Array> &original_array) {
-      arrow::compute::CastOptions cast_options;
-      cast_options.to_type = arrow::int64();
-
-      auto first_converted_array = CheckConversion(
-        arrow::compute::Cast(original_array, cast_options));
-
-      auto seconds_from_epoch = GetTodayTimeFromEpoch();
-
-      auto second_converted_array = CheckConversion(
-        arrow::compute::Add(first_converted_array,
-                            std::make_shared<arrow::Int64Scalar>(seconds_from_epoch * 1000000000)));
-
-      arrow::compute::CastOptions cast_options_2;
-      cast_options_2.to_type = arrow::timestamp(arrow::TimeUnit::NANO);
-
-      return CheckConversion(
-        arrow::compute::Cast(second_converted_array, cast_options_2));
-    };
-  } else if (original_type_id == arrow::Type::STRING &&
-             target_type == odbcabstraction::CDataType_DATE) {
-    return [=](const std::shared_ptr<arrow::Array> &original_array) {
-      // The Strptime requires a date format. Using the ISO 8601 format
-      arrow::compute::StrptimeOptions options("%Y-%m-%d",
-                                              arrow::TimeUnit::SECOND);
-
-      auto converted_result =
-        arrow::compute::Strptime({original_array}, options);
-
-      auto first_converted_array = CheckConversion(converted_result);
-      arrow::compute::CastOptions cast_options;
-      cast_options.to_type = arrow::date64();
-      return CheckConversion(arrow::compute::CallFunction(
-        "cast", {first_converted_array}, &cast_options));
-    };
-  } else if (original_type_id == arrow::Type::DECIMAL128 &&
-             (target_type == odbcabstraction::CDataType_CHAR ||
-              target_type == odbcabstraction::CDataType_WCHAR)) {
+  if (original_type_id == arrow::Type::DECIMAL128 &&
+      (target_type == odbcabstraction::CDataType_CHAR ||
+       target_type == odbcabstraction::CDataType_WCHAR)) {
     return [=](const std::shared_ptr<arrow::Array> &original_array) {
       arrow::StringBuilder builder;
       int64_t length = original_array->length();
@@ -1001,6 +1149,12 @@ ArrayConvertTask GetConverter(arrow::Type::type original_type_id,
 
       return finish.ValueOrDie();
     };
+  } else if (IsIntervalArrowType(original_type_id) &&
+             (target_type == odbcabstraction::CDataType_CHAR ||
+              target_type == odbcabstraction::CDataType_WCHAR)) {
+    return [=](const std::shared_ptr<arrow::Array> &original_array) {
+      return FormatIntervalArray(*original_array);
+    };
   } else if (IsComplexType(original_type_id) &&
              (target_type == odbcabstraction::CDataType_CHAR ||
               target_type == odbcabstraction::CDataType_WCHAR)) {
@@ -89,6 +89,21 @@ std::string ConvertSqlPatternToRegexString(const std::string &pattern);
 
 boost::xpressive::sregex ConvertSqlPatternToRegex(const std::string &pattern);
 
+bool IsNumericArrowType(arrow::Type::type type_id);
+
+bool IsNumericCDataType(odbcabstraction::CDataType data_type);
+
+bool IsIntervalArrowType(arrow::Type::type type_id);
+
+bool IsIntervalCDataType(odbcabstraction::CDataType data_type);
+
+/// \brief Carries whole days out of \p nanoseconds and gives both parts the
+/// same sign, so that |nanoseconds| is less than one day.
+void NormalizeDayTimeInterval(int64_t &days, int64_t &nanoseconds);
+
+/// \brief Whether \p type is the arrow.uuid canonical extension type.
+bool IsUuidType(const arrow::DataType &type);
+
 bool NeedArrayConversion(arrow::Type::type original_type_id,
                          odbcabstraction::CDataType data_type);
 
@@ -98,6 +113,10 @@ arrow::Type::type ConvertCToArrowType(odbcabstraction::CDataType data_type);
 
 odbcabstraction::CDataType ConvertArrowTypeToC(arrow::Type::type type_id, bool useWideChar);
 
+/// \brief Default C type for \p type. Unlike the overload taking a type id,
+/// this one tells UUID extension columns apart.
+odbcabstraction::CDataType ConvertArrowTypeToC(const arrow::DataType &type, bool useWideChar);
+
 std::shared_ptr<arrow::Array> CheckConversion(const arrow::Result<arrow::Datum> &result);
 
 ArrayConvertTask GetConverter(arrow::Type::type original_type_id,
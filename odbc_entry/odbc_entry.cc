@@ -160,8 +160,9 @@ static void FillFunctionBitmap(SQLUSMALLINT *bitmap) {
   SetFunction(bitmap, SQL_API_SQLGETDIAGREC);
   SetFunction(bitmap, SQL_API_SQLGETDIAGFIELD);
 
-  // Parameters (stub but declared)
+  // Parameters
   SetFunction(bitmap, SQL_API_SQLBINDPARAMETER);
+  SetFunction(bitmap, SQL_API_SQLDESCRIBEPARAM);
   SetFunction(bitmap, SQL_API_SQLNUMPARAMS);
 
   // Cursor
@@ -243,6 +244,9 @@ static SQLRETURN FreeHandleImpl(SQLSMALLINT handleType, SQLHANDLE handle) {
   }
   case SQL_HANDLE_STMT: {
     auto *stmt = ODBCStatement::of(handle);
+    // An asynchronous function in progress holds the handle lock until it completes, so it is
+    // interrupted before waiting for that lock.
+    stmt->CancelAsync();
     SQLRETURN ret = ODBCStatement::ExecuteWithDiagnostics(
         handle, SQL_SUCCESS, [&]() {
           stmt->releaseStatement();
@@ -292,16 +296,18 @@ SQLRETURN SQL_API SQLFreeStmt(SQLHSTMT hStmt, SQLUSMALLINT option) {
           ODBCStatement::of(hStmt)->closeCursor(true);
           return SQL_SUCCESS;
         });
-  case SQL_UNBIND: {
-    if (!hStmt) return SQL_INVALID_HANDLE;
-    auto *stmt = ODBCStatement::of(hStmt);
-    auto *ard = stmt->GetARD();
-    ard->GetRecords().clear();
-    return SQL_SUCCESS;
-  }
+  case SQL_UNBIND:
+    return ODBCStatement::ExecuteWithDiagnostics(
+        hStmt, SQL_SUCCESS, [&]() {
+          ODBCStatement::of(hStmt)->GetARD()->GetRecords().clear();
+          return SQL_SUCCESS;
+        });
   case SQL_RESET_PARAMS:
-    // No parameter support — no-op.
-    return SQL_SUCCESS;
+    return ODBCStatement::ExecuteWithDiagnostics(
+        hStmt, SQL_SUCCESS, [&]() {
+          ODBCStatement::of(hStmt)->ResetParameters();
+          return SQL_SUCCESS;
+        });
   case SQL_DROP:
     return FreeHandleImpl(SQL_HANDLE_STMT, hStmt);
   default:
@@ -707,8 +713,8 @@ SQLRETURN SQL_API SQLNativeSqlW(SQLHDBC hDbc, SQLWCHAR *inSql,
 
 SQLRETURN SQL_API SQLPrepare(SQLHSTMT hStmt, SQLCHAR *sqlStr,
                             SQLINTEGER sqlStrLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLPREPARE, [=]() {
         std::string sql = SqlCharToString(
             sqlStr, sqlStrLen == SQL_NTS ? SQL_NTS : static_cast<SQLSMALLINT>(sqlStrLen));
         ODBCStatement::of(hStmt)->Prepare(sql);
@@ -718,8 +724,8 @@ SQLRETURN SQL_API SQLPrepare(SQLHSTMT hStmt, SQLCHAR *sqlStr,
 
 SQLRETURN SQL_API SQLPrepareW(SQLHSTMT hStmt, SQLWCHAR *sqlStr,
                              SQLINTEGER sqlStrLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLPREPARE, [=]() {
         std::string sql = SqlWCharToString(
             sqlStr, sqlStrLen == SQL_NTS ? SQL_NTS : static_cast<SQLSMALLINT>(sqlStrLen));
         ODBCStatement::of(hStmt)->Prepare(sql);
@@ -728,8 +734,8 @@ SQLRETURN SQL_API SQLPrepareW(SQLHSTMT hStmt, SQLWCHAR *sqlStr,
 }
 
 SQLRETURN SQL_API SQLExecute(SQLHSTMT hStmt) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLEXECUTE, [=]() {
         ODBCStatement::of(hStmt)->ExecutePrepared();
         return SQL_SUCCESS;
       });
@@ -737,8 +743,8 @@ SQLRETURN SQL_API SQLExecute(SQLHSTMT hStmt) {
 
 SQLRETURN SQL_API SQLExecDirect(SQLHSTMT hStmt, SQLCHAR *sqlStr,
                                SQLINTEGER sqlStrLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLEXECDIRECT, [=]() {
         std::string sql = SqlCharToString(
             sqlStr, sqlStrLen == SQL_NTS ? SQL_NTS : static_cast<SQLSMALLINT>(sqlStrLen));
         ODBCStatement::of(hStmt)->ExecuteDirect(sql);
@@ -748,8 +754,8 @@ SQLRETURN SQL_API SQLExecDirect(SQLHSTMT hStmt, SQLCHAR *sqlStr,
 
 SQLRETURN SQL_API SQLExecDirectW(SQLHSTMT hStmt, SQLWCHAR *sqlStr,
                                 SQLINTEGER sqlStrLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLEXECDIRECT, [=]() {
         std::string sql = SqlWCharToString(
             sqlStr, sqlStrLen == SQL_NTS ? SQL_NTS : static_cast<SQLSMALLINT>(sqlStrLen));
         ODBCStatement::of(hStmt)->ExecuteDirect(sql);
@@ -758,6 +764,10 @@ SQLRETURN SQL_API SQLExecDirectW(SQLHSTMT hStmt, SQLWCHAR *sqlStr,
 }
 
 SQLRETURN SQL_API SQLCancel(SQLHSTMT hStmt) {
+  // An asynchronous function holds the statement, so it is interrupted without waiting for it.
+  if (hStmt && ODBCStatement::of(hStmt)->CancelAsync()) {
+    return SQL_SUCCESS;
+  }
   return ODBCStatement::ExecuteWithDiagnostics(
       hStmt, SQL_SUCCESS, [&]() {
         ODBCStatement::of(hStmt)->Cancel();
@@ -770,8 +780,8 @@ SQLRETURN SQL_API SQLCancel(SQLHSTMT hStmt) {
 // ============================================================================
 
 SQLRETURN SQL_API SQLFetch(SQLHSTMT hStmt) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLFETCH, [=]() {
         auto *stmt = ODBCStatement::of(hStmt);
         bool hasData = stmt->Fetch(stmt->GetARD()->GetArraySize());
         return hasData ? SQL_SUCCESS : SQL_NO_DATA;
@@ -798,8 +808,8 @@ SQLRETURN SQL_API SQLExtendedFetch(SQLHSTMT hStmt, SQLUSMALLINT orientation,
           throw DriverException("Fetch type out of range. Only SQL_FETCH_NEXT is supported.", "HY106");
         });
   }
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLEXTENDEDFETCH, [=]() {
         auto *stmt = ODBCStatement::of(hStmt);
         bool hasData = stmt->Fetch(stmt->GetRowsetSize());
         return hasData ? SQL_SUCCESS : SQL_NO_DATA;
@@ -950,7 +960,10 @@ SQLRETURN SQL_API SQLRowCount(SQLHSTMT hStmt, SQLLEN *rowCount) {
 }
 
 SQLRETURN SQL_API SQLMoreResults(SQLHSTMT hStmt) {
-  return SQL_NO_DATA;
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLMORERESULTS, [=]() {
+        return ODBCStatement::of(hStmt)->MoreResults() ? SQL_SUCCESS : SQL_NO_DATA;
+      });
 }
 
 SQLRETURN SQL_API SQLCloseCursor(SQLHSTMT hStmt) {
@@ -1171,8 +1184,8 @@ SQLRETURN SQL_API SQLTables(SQLHSTMT hStmt, SQLCHAR *catalog,
                            SQLSMALLINT schemaLen, SQLCHAR *table,
                            SQLSMALLINT tableLen, SQLCHAR *tableType,
                            SQLSMALLINT tableTypeLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLTABLES, [=]() {
         auto cat = ToOptionalString(catalog, catalogLen);
         auto sch = ToOptionalString(schema, schemaLen);
         auto tbl = ToOptionalString(table, tableLen);
@@ -1188,8 +1201,8 @@ SQLRETURN SQL_API SQLTablesW(SQLHSTMT hStmt, SQLWCHAR *catalog,
                             SQLSMALLINT schemaLen, SQLWCHAR *table,
                             SQLSMALLINT tableLen, SQLWCHAR *tableType,
                             SQLSMALLINT tableTypeLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLTABLES, [=]() {
         auto cat = ToOptionalStringW(catalog, catalogLen);
         auto sch = ToOptionalStringW(schema, schemaLen);
         auto tbl = ToOptionalStringW(table, tableLen);
@@ -1205,8 +1218,8 @@ SQLRETURN SQL_API SQLColumns(SQLHSTMT hStmt, SQLCHAR *catalog,
                             SQLSMALLINT schemaLen, SQLCHAR *table,
                             SQLSMALLINT tableLen, SQLCHAR *column,
                             SQLSMALLINT columnLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLCOLUMNS, [=]() {
         auto cat = ToOptionalString(catalog, catalogLen);
         auto sch = ToOptionalString(schema, schemaLen);
         auto tbl = ToOptionalString(table, tableLen);
@@ -1222,8 +1235,8 @@ SQLRETURN SQL_API SQLColumnsW(SQLHSTMT hStmt, SQLWCHAR *catalog,
                              SQLSMALLINT schemaLen, SQLWCHAR *table,
                              SQLSMALLINT tableLen, SQLWCHAR *column,
                              SQLSMALLINT columnLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLCOLUMNS, [=]() {
         auto cat = ToOptionalStringW(catalog, catalogLen);
         auto sch = ToOptionalStringW(schema, schemaLen);
         auto tbl = ToOptionalStringW(table, tableLen);
@@ -1235,8 +1248,8 @@ SQLRETURN SQL_API SQLColumnsW(SQLHSTMT hStmt, SQLWCHAR *catalog,
 }
 
 SQLRETURN SQL_API SQLGetTypeInfo(SQLHSTMT hStmt, SQLSMALLINT dataType) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLGETTYPEINFO, [=]() {
         ODBCStatement::of(hStmt)->GetTypeInfo(dataType);
         return SQL_SUCCESS;
       });
@@ -1250,8 +1263,8 @@ SQLRETURN SQL_API SQLPrimaryKeys(SQLHSTMT hStmt, SQLCHAR *catalog,
                                 SQLSMALLINT catalogLen, SQLCHAR *schema,
                                 SQLSMALLINT schemaLen, SQLCHAR *table,
                                 SQLSMALLINT tableLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLPRIMARYKEYS, [=]() {
         auto cat = ToOptionalString(catalog, catalogLen);
         auto sch = ToOptionalString(schema, schemaLen);
         auto tbl = ToOptionalString(table, tableLen);
@@ -1265,8 +1278,8 @@ SQLRETURN SQL_API SQLPrimaryKeysW(SQLHSTMT hStmt, SQLWCHAR *catalog,
                                  SQLSMALLINT catalogLen, SQLWCHAR *schema,
                                  SQLSMALLINT schemaLen, SQLWCHAR *table,
                                  SQLSMALLINT tableLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLPRIMARYKEYS, [=]() {
         auto cat = ToOptionalStringW(catalog, catalogLen);
         auto sch = ToOptionalStringW(schema, schemaLen);
         auto tbl = ToOptionalStringW(table, tableLen);
@@ -1282,8 +1295,8 @@ SQLRETURN SQL_API SQLForeignKeys(
     SQLSMALLINT pkTableLen, SQLCHAR *fkCatalog, SQLSMALLINT fkCatalogLen,
     SQLCHAR *fkSchema, SQLSMALLINT fkSchemaLen, SQLCHAR *fkTable,
     SQLSMALLINT fkTableLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLFOREIGNKEYS, [=]() {
         auto pkCat = ToOptionalString(pkCatalog, pkCatalogLen);
         auto pkSch = ToOptionalString(pkSchema, pkSchemaLen);
         auto pkTbl = ToOptionalString(pkTable, pkTableLen);
@@ -1303,8 +1316,8 @@ SQLRETURN SQL_API SQLForeignKeysW(
     SQLSMALLINT pkTableLen, SQLWCHAR *fkCatalog, SQLSMALLINT fkCatalogLen,
     SQLWCHAR *fkSchema, SQLSMALLINT fkSchemaLen, SQLWCHAR *fkTable,
     SQLSMALLINT fkTableLen) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_SUCCESS, [&]() {
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLFOREIGNKEYS, [=]() {
         auto pkCat = ToOptionalStringW(pkCatalog, pkCatalogLen);
         auto pkSch = ToOptionalStringW(pkSchema, pkSchemaLen);
         auto pkTbl = ToOptionalStringW(pkTable, pkTableLen);
@@ -1456,7 +1469,8 @@ SQLRETURN SQL_API SQLGetDiagRec(SQLSMALLINT handleType, SQLHANDLE handle,
     diag = &ODBCConnection::of(handle)->GetDiagnostics();
     break;
   case SQL_HANDLE_STMT:
-    diag = &ODBCStatement::of(handle)->GetDiagnostics();
+    // An asynchronous function records its diagnostics until it is polled to completion.
+    diag = &ODBCStatement::of(handle)->GetReportedDiagnostics();
     break;
   case SQL_HANDLE_DESC:
     diag = &ODBCDescriptor::of(handle)->GetDiagnostics();
@@ -1507,7 +1521,8 @@ SQLRETURN SQL_API SQLGetDiagRecW(SQLSMALLINT handleType, SQLHANDLE handle,
     diag = &ODBCConnection::of(handle)->GetDiagnostics();
     break;
   case SQL_HANDLE_STMT:
-    diag = &ODBCStatement::of(handle)->GetDiagnostics();
+    // An asynchronous function records its diagnostics until it is polled to completion.
+    diag = &ODBCStatement::of(handle)->GetReportedDiagnostics();
     break;
   case SQL_HANDLE_DESC:
     diag = &ODBCDescriptor::of(handle)->GetDiagnostics();
@@ -1565,7 +1580,8 @@ SQLRETURN SQL_API SQLGetDiagField(SQLSMALLINT handleType, SQLHANDLE handle,
     diag = &ODBCConnection::of(handle)->GetDiagnostics();
     break;
   case SQL_HANDLE_STMT:
-    diag = &ODBCStatement::of(handle)->GetDiagnostics();
+    // An asynchronous function records its diagnostics until it is polled to completion.
+    diag = &ODBCStatement::of(handle)->GetReportedDiagnostics();
     break;
   case SQL_HANDLE_DESC:
     diag = &ODBCDescriptor::of(handle)->GetDiagnostics();
@@ -1712,7 +1728,7 @@ SQLRETURN SQL_API SQLErrorW(SQLHENV hEnv, SQLHDBC hDbc, SQLHSTMT hStmt,
 }
 
 // ============================================================================
-// Parameter Stubs (not supported)
+// Parameters
 // ============================================================================
 
 SQLRETURN SQL_API SQLBindParameter(SQLHSTMT hStmt, SQLUSMALLINT paramNum,
@@ -1722,8 +1738,11 @@ SQLRETURN SQL_API SQLBindParameter(SQLHSTMT hStmt, SQLUSMALLINT paramNum,
                                   SQLLEN bufferLength,
                                   SQLLEN *strLenOrInd) {
   return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_ERROR, [&]() -> SQLRETURN {
-        throw DriverException("SQLBindParameter not supported", "HYC00");
+      hStmt, SQL_SUCCESS, [&]() {
+        ODBCStatement::of(hStmt)->BindParameter(
+            paramNum, ioType, valueType, paramType, colSize, decDigits,
+            paramValue, bufferLength, strLenOrInd);
+        return SQL_SUCCESS;
       });
 }
 
@@ -1732,8 +1751,10 @@ SQLRETURN SQL_API SQLDescribeParam(SQLHSTMT hStmt, SQLUSMALLINT paramNum,
                                   SQLSMALLINT *decDigits,
                                   SQLSMALLINT *nullable) {
   return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_ERROR, [&]() -> SQLRETURN {
-        throw DriverException("SQLDescribeParam not supported", "HYC00");
+      hStmt, SQL_SUCCESS, [&]() {
+        ODBCStatement::of(hStmt)->DescribeParameter(paramNum, dataType, paramSize,
+                                                    decDigits, nullable);
+        return SQL_SUCCESS;
       });
 }
 
@@ -1755,7 +1776,8 @@ SQLRETURN SQL_API SQLPutData(SQLHSTMT hStmt, SQLPOINTER data,
 SQLRETURN SQL_API SQLNumParams(SQLHSTMT hStmt, SQLSMALLINT *paramCount) {
   return ODBCStatement::ExecuteWithDiagnostics(
       hStmt, SQL_SUCCESS, [&]() {
-        if (paramCount) *paramCount = 0;
+        const size_t count = ODBCStatement::of(hStmt)->GetParameterCount();
+        if (paramCount) *paramCount = static_cast<SQLSMALLINT>(count);
         return SQL_SUCCESS;
       });
 }
@@ -1817,9 +1839,15 @@ SQLRETURN SQL_API SQLSetCursorNameW(SQLHSTMT hStmt, SQLWCHAR *cursorName,
 
 SQLRETURN SQL_API SQLBulkOperations(SQLHSTMT hStmt,
                                    SQLSMALLINT operation) {
-  return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_ERROR, [&]() -> SQLRETURN {
-        throw DriverException("SQLBulkOperations not supported", "HYC00");
+  return ODBCStatement::ExecuteAsyncWithDiagnostics(
+      hStmt, SQL_API_SQLBULKOPERATIONS, [=]() -> SQLRETURN {
+        // Only appending rows is supported: the cursor is forward-only and
+        // read-only, so there are no positioned rows to update or delete.
+        if (operation != SQL_ADD) {
+          throw DriverException("Optional feature not implemented", "HYC00");
+        }
+        ODBCStatement::of(hStmt)->BulkAdd();
+        return SQL_SUCCESS;
       });
 }
 
@@ -1848,8 +1876,12 @@ SQLRETURN SQL_API SQLSetScrollOptions(SQLHSTMT hStmt,
 SQLRETURN SQL_API SQLParamOptions(SQLHSTMT hStmt, SQLULEN crowRow,
                                  SQLULEN *pirow) {
   return ODBCStatement::ExecuteWithDiagnostics(
-      hStmt, SQL_ERROR, [&]() -> SQLRETURN {
-        throw DriverException("SQLParamOptions not supported", "HYC00");
+      hStmt, SQL_SUCCESS, [&]() {
+        auto *stmt = ODBCStatement::of(hStmt);
+        stmt->SetStmtAttr(SQL_ATTR_PARAMSET_SIZE,
+                          reinterpret_cast<SQLPOINTER>(crowRow), 0, false);
+        stmt->SetStmtAttr(SQL_ATTR_PARAMS_PROCESSED_PTR, pirow, 0, false);
+        return SQL_SUCCESS;
       });
 }
 
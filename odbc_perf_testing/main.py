@@ -9,13 +9,13 @@ import argparse
 import json
 from typing import Dict, List
 
-from test_cases import test_fetch_all, test_data_types
+from test_cases import test_fetch_all, test_fetch_wide, test_data_types
 from test_strategy.base_strategy import BaseStrategy
 from test_strategy.execution_details import ExecutionDetails, ConnectionDetails, TestDetails
 from test_strategy.pyodbc_strategy import PyOdbcStrategy
 from test_strategy.turbodbc_strategy import TurbodbcStrategy
 
-VALID_TEST_CASES: List[str] = ['test-fetch-all', 'test-sql-type-{typename}']
+VALID_TEST_CASES: List[str] = ['test-fetch-all', 'test-fetch-wide', 'test-sql-type-{typename}']
 VALID_ODBC_LIBRARIES: List[str] = ['pyodbc', 'turbodbc']
 
 
@@ -28,6 +28,11 @@ def start_new_test_process(
             test_name=test_case_all_lower,
             strategy=strategy
         )
+    elif 'test-fetch-wide' in test_case_all_lower:
+        test_fetch_wide.run(
+            test_name=test_case_all_lower,
+            strategy=strategy
+        )
     elif 'test-sql-type-' in test_case_all_lower:
         type_name: str = test_case_all_lower.split('-')[-1]  # Get type name in the end of the test case name
         test_data_types.run(
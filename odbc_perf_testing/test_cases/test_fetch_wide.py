@@ -0,0 +1,31 @@
+#
+# Copyright (C) 2020-2022 Dremio Corporation
+# Copyright (C) 2026 GizmoData LLC
+#
+# See "LICENSE" for license information.
+
+from typing import List
+
+from test_cases import test_fetch_all
+from test_strategy.base_strategy import BaseStrategy
+
+SCHEMA: str = 'nas'
+TABLE: str = '"data_1000000_rows.parquet"'
+
+# Fixed-width columns repeated to build a wide result set, so fetch time is
+# dominated by converting bound columns rather than by string handling.
+WIDE_SOURCE_COLUMNS: List[str] = ['intcol', 'bigintcol', 'floatcol', 'doublecol', 'booleancol']
+WIDE_COLUMN_COUNT: int = 50
+
+
+def build_wide_query(column_count: int = WIDE_COLUMN_COUNT) -> str:
+    columns: List[str] = [
+        f'{WIDE_SOURCE_COLUMNS[i % len(WIDE_SOURCE_COLUMNS)]} AS c{i}'
+        for i in range(column_count)
+    ]
+    return f'SELECT {", ".join(columns)} FROM {SCHEMA}.{TABLE}'
+
+
+def run(test_name: str, strategy: BaseStrategy) -> None:
+    strategy.set_sql_query(build_wide_query())
+    test_fetch_all.run(test_name=test_name, strategy=strategy)
@@ -9,6 +9,7 @@
 #include <odbcabstraction/platform.h>
 #include <odbcabstraction/types.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace {
@@ -64,6 +65,49 @@ auto record = std::unique_ptr<DiagnosticsRecord>(new DiagnosticsRecord{
   owned_records_.push_back(std::move(record));
 }
 
+void driver::odbcabstraction::Diagnostics::AddCoalescedWarning(
+    std::string_view message, std::string_view sql_state, int32_t native_error) {
+  for (DiagnosticsRecord *record : coalesced_records_) {
+    if (record->native_error_ == native_error && record->sql_state_ == sql_state &&
+        record->msg_text_ == message) {
+      ++record->occurrences_;
+      return;
+    }
+  }
+  AddWarning(std::string(message), std::string(sql_state), native_error);
+  coalesced_records_.push_back(owned_records_.back().get());
+}
+
+void driver::odbcabstraction::Diagnostics::TakeRecords(Diagnostics &other) {
+  error_records_.insert(error_records_.end(), other.error_records_.begin(),
+                        other.error_records_.end());
+  for (const DiagnosticsRecord *record : other.warning_records_) {
+    auto coalesced = std::find(other.coalesced_records_.begin(),
+                               other.coalesced_records_.end(), record);
+    if (coalesced == other.coalesced_records_.end()) {
+      warning_records_.push_back(record);
+      continue;
+    }
+    // Fold the other instance's count into a matching warning of this one.
+    auto match = std::find_if(coalesced_records_.begin(), coalesced_records_.end(),
+                              [record](const DiagnosticsRecord *own) {
+                                return own->native_error_ == record->native_error_ &&
+                                       own->sql_state_ == record->sql_state_ &&
+                                       own->msg_text_ == record->msg_text_;
+                              });
+    if (match != coalesced_records_.end()) {
+      (*match)->occurrences_ += record->occurrences_;
+    } else {
+      warning_records_.push_back(record);
+      coalesced_records_.push_back(*coalesced);
+    }
+  }
+  for (auto &record : other.owned_records_) {
+    owned_records_.push_back(std::move(record));
+  }
+  other.Clear();
+}
+
 std::string driver::odbcabstraction::Diagnostics::GetMessageText(
     uint32_t record_index) const {
   std::string message;
@@ -71,7 +115,11 @@ std::string driver::odbcabstraction::Diagnostics::GetMessageText(
     message += std::string("[") + vendor_ + "]";
   }
   const DiagnosticsRecord* rec = GetRecordAtIndex(record_index);
-  return message + "[" + data_source_component_ + "] (" + std::to_string(rec->native_error_) + ") " + rec->msg_text_;
+  message += "[" + data_source_component_ + "] (" + std::to_string(rec->native_error_) + ") " + rec->msg_text_;
+  if (rec->occurrences_ > 1) {
+    message += " (" + std::to_string(rec->occurrences_) + " occurrences)";
+  }
+  return message;
 }
 
 OdbcVersion Diagnostics::GetOdbcVersion() const { return version_; }
@@ -51,6 +51,10 @@ public:
     }
 
   void AddProducer(Supplier supplier) {
+    // Producers may be added while items are consumed, so this must not race with Close.
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (closed_) return;
+
     active_threads_++;
     threads_.emplace_back([=] {
       while (!closed_) {
@@ -72,6 +76,19 @@ public:
     });
   }
 
+  /// \brief Keeps Pop waiting for items, even when no producer is running,
+  /// until ReleaseHold is called. Used while more producers may be added.
+  void Hold() {
+    std::unique_lock<std::mutex> unique_lock(mtx_);
+    active_threads_++;
+  }
+
+  void ReleaseHold() {
+    std::unique_lock<std::mutex> unique_lock(mtx_);
+    active_threads_--;
+    not_empty_.notify_all();
+  }
+
   bool Pop(T *result) {
     std::unique_lock<std::mutex> unique_lock(mtx_);
     if (!WaitUntilCanPopOrClosed(unique_lock)) return false;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 
@@ -22,12 +23,16 @@ namespace odbcabstraction {
       std::string msg_text_;
       std::string sql_state_;
       int32_t native_error_;
+      // Times a coalesced warning was raised, reported with its message.
+      size_t occurrences_ = 1;
     };
 
   private:
     std::vector<const DiagnosticsRecord*> error_records_;
     std::vector<const DiagnosticsRecord*> warning_records_;
     std::vector<std::unique_ptr<DiagnosticsRecord>> owned_records_;
+    // Warnings added through AddCoalescedWarning, one per distinct warning.
+    std::vector<DiagnosticsRecord*> coalesced_records_;
     std::string vendor_;
     std::string data_source_component_;
     OdbcVersion version_;
@@ -37,13 +42,17 @@ namespace odbcabstraction {
     void AddError(const DriverException& exception);
     void AddWarning(std::string message, std::string sql_state, int32_t native_error);
 
-    /// \brief Add a pre-existing truncation warning.
+    /// \brief Add a warning that may be raised for many rows or cells of one
+    /// call. Repeats only count against the first record of the same warning,
+    /// so memory use and SQLGetDiagRec stay constant however often it is
+    /// raised; the row status array carries the per-row detail.
+    void AddCoalescedWarning(std::string_view message, std::string_view sql_state,
+                             int32_t native_error);
+
+    /// \brief Add a string or binary data truncation warning.
     inline void AddTruncationWarning() {
-      static const std::unique_ptr<DiagnosticsRecord> TRUNCATION_WARNING(new DiagnosticsRecord {
-          "String or binary data, right-truncated.", "01004",
-          ODBCErrorCodes_TRUNCATION_WARNING
-      });
-      warning_records_.push_back(TRUNCATION_WARNING.get());
+      AddCoalescedWarning("String or binary data, right-truncated.", "01004",
+                          ODBCErrorCodes_TRUNCATION_WARNING);
     }
 
     inline void TrackRecord(const DiagnosticsRecord& record) {
@@ -54,6 +63,10 @@ namespace odbcabstraction {
       }
     }
 
+    /// \brief Move every record of another instance after the records of this
+    /// one, keeping their order, and leave the other instance empty.
+    void TakeRecords(Diagnostics &other);
+
     void SetDataSourceComponent(std::string component);
     std::string GetDataSourceComponent() const;
 
@@ -63,6 +76,7 @@ namespace odbcabstraction {
       error_records_.clear();
       warning_records_.clear();
       owned_records_.clear();
+      coalesced_records_.clear();
     }
 
     std::string GetMessageText(uint32_t record_index) const;
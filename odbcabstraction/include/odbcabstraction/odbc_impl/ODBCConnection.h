@@ -15,6 +15,14 @@
 #include <map>
 #include <odbcabstraction/spi/connection.h>
 
+/**
+ * Driver-specific read-only connection attributes (SQL_DRIVER_CONN_ATTR_BASE + 1 and + 2)
+ * counting, as SQLUINTEGERs, the queries the result cache answered and the cacheable queries
+ * it could not answer. Both are 0 while the cache is disabled.
+ */
+#define SQL_ATTR_GIZMOSQL_RESULT_CACHE_HITS 0x4001
+#define SQL_ATTR_GIZMOSQL_RESULT_CACHE_MISSES 0x4002
+
 namespace ODBC
 {
   class ODBCEnvironment;
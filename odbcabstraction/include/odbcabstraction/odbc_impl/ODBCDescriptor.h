@@ -103,6 +103,7 @@ namespace ODBC
       std::vector<DescriptorRecord>& GetRecords();
 
       void BindCol(SQLSMALLINT recordNumber, SQLSMALLINT cType, SQLPOINTER dataPtr, SQLLEN bufferLength, SQLLEN* indicatorPtr);
+      void BindParameterType(SQLSMALLINT recordNumber, SQLSMALLINT ioType, SQLSMALLINT sqlType, SQLULEN columnSize, SQLSMALLINT decimalDigits);
       void SetDataPtrOnRecord(SQLPOINTER dataPtr, SQLSMALLINT recNumber);
 
       inline SQLULEN GetBindOffset() {
@@ -11,8 +11,38 @@
 
 #include <odbcabstraction/platform.h>
 #include <sql.h>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+
+/**
+ * Driver-specific statement attribute (SQL_DRIVER_STMT_ATTR_BASE + 1) naming the table
+ * SQLBulkOperations with SQL_ADD appends to, as "table", "schema.table" or
+ * "catalog.schema.table". While it is set, added rowsets are streamed to the server in one
+ * bulk load, which completes when the attribute is changed or the cursor is closed.
+ */
+#define SQL_ATTR_GIZMOSQL_BULK_LOAD_TABLE 0x4001
+
+/**
+ * Driver-specific read-only statement attribute (SQL_DRIVER_STMT_ATTR_BASE + 2) reporting,
+ * as a SQLULEN from 0 to 100, the percentage of the last query the server completed. Only
+ * queries executed through PollFlightInfo report partial progress.
+ */
+#define SQL_ATTR_GIZMOSQL_QUERY_PROGRESS 0x4002
+
+/**
+ * Driver-specific statement attribute (SQL_DRIVER_STMT_ATTR_BASE + 3) choosing how statements
+ * are executed. Updates return a row count from a single call, without a result set.
+ */
+#define SQL_ATTR_GIZMOSQL_EXECUTE_MODE 0x4003
+/// INSERT, UPDATE, DELETE, MERGE and DDL statements without RETURNING run as updates.
+#define SQL_GIZMOSQL_EXECUTE_AUTO 0
+/// Every statement returns a result set.
+#define SQL_GIZMOSQL_EXECUTE_QUERY 1
+/// Every statement runs as an update.
+#define SQL_GIZMOSQL_EXECUTE_UPDATE 2
 
 namespace driver {
 namespace odbcabstraction {
@@ -39,7 +69,7 @@ class ODBCStatement : public ODBCHandle<ODBCStatement> {
     ODBCStatement(ODBCConnection& connection, 
       std::shared_ptr<driver::odbcabstraction::Statement> spiStatement);
     
-    ~ODBCStatement() = default;
+    ~ODBCStatement();
 
     inline driver::odbcabstraction::Diagnostics& GetDiagnostics_Impl() {
       return *m_diagnostics;
@@ -47,6 +77,38 @@ class ODBCStatement : public ODBCHandle<ODBCStatement> {
 
     ODBCConnection &GetConnection();
 
+    /**
+     * @brief Runs a statement function like ExecuteWithDiagnostics. When SQL_ATTR_ASYNC_ENABLE
+     * is on, the function runs on a driver thread and SQL_STILL_EXECUTING is returned until it
+     * completes; the application polls by calling the same ODBC function again.
+     */
+    template <typename Function>
+    static SQLRETURN ExecuteAsyncWithDiagnostics(SQLHANDLE handle, SQLUSMALLINT functionId,
+                                                 Function function) {
+      if (!handle) {
+        return SQL_INVALID_HANDLE;
+      }
+      return of(handle)->ExecuteAsync(functionId, std::function<SQLRETURN()>(std::move(function)));
+    }
+
+    /**
+     * @brief Returns true while an asynchronous function has not reported its completion.
+     */
+    bool IsExecutingAsync();
+
+    /**
+     * @brief Returns the diagnostics SQLGetDiagRec reports. While an asynchronous function
+     * runs, these only hold the errors of the calls rejected meanwhile, since the running
+     * function records its own until it completes.
+     */
+    driver::odbcabstraction::Diagnostics& GetReportedDiagnostics();
+
+    /**
+     * @brief Cancels the asynchronous function in progress (SQLCancel). Returns false if there
+     * is none.
+     */
+    bool CancelAsync();
+
     void CopyAttributesFromConnection(ODBCConnection& connection);
     void Prepare(const std::string& query);
     void ExecutePrepared();
@@ -58,6 +120,12 @@ class ODBCStatement : public ODBCHandle<ODBCStatement> {
     bool Fetch(size_t rows);
     bool isPrepared() const;
 
+    /**
+     * @brief Moves to the results of the next statement of an executed batch.
+     * Returns false when there are no more results.
+     */
+    bool MoreResults();
+
     void GetStmtAttr(SQLINTEGER statementAttribute, SQLPOINTER output,
                      SQLINTEGER bufferSize, SQLINTEGER *strLenPtr, bool isUnicode);
     void SetStmtAttr(SQLINTEGER statementAttribute, SQLPOINTER value,
@@ -65,9 +133,11 @@ class ODBCStatement : public ODBCHandle<ODBCStatement> {
 
     void RevertAppDescriptor(bool isApd);
 
-    inline ODBCDescriptor* GetIRD() {
-      return m_ird.get();
-    }
+    /**
+     * @brief Returns the IRD, describing the prepared statement first if its
+     * preparation was deferred.
+     */
+    ODBCDescriptor* GetIRD();
 
     inline ODBCDescriptor* GetARD() {
       return m_currentArd;
@@ -79,9 +149,32 @@ class ODBCStatement : public ODBCHandle<ODBCStatement> {
 
     bool GetData(SQLSMALLINT recordNumber, SQLSMALLINT cType, SQLPOINTER dataPtr, SQLLEN bufferLength, SQLLEN* indicatorPtr);
 
+    void BindParameter(SQLUSMALLINT parameterNumber, SQLSMALLINT ioType, SQLSMALLINT cType,
+                       SQLSMALLINT sqlType, SQLULEN columnSize, SQLSMALLINT decimalDigits,
+                       SQLPOINTER dataPtr, SQLLEN bufferLength, SQLLEN* indicatorPtr);
+
+    /**
+     * @brief Unbinds every parameter (SQLFreeStmt with SQL_RESET_PARAMS).
+     */
+    void ResetParameters();
+
+    /**
+     * @brief Returns the number of parameter markers of the prepared statement.
+     */
+    size_t GetParameterCount();
+
+    void DescribeParameter(SQLUSMALLINT parameterNumber, SQLSMALLINT* dataType, SQLULEN* parameterSize,
+                           SQLSMALLINT* decimalDigits, SQLSMALLINT* nullable);
+
     /**
-     * @brief Closes the cursor. This does _not_ un-prepare the statement or change
-     * bindings.
+     * @brief Appends the bound rowset to a table (SQLBulkOperations with SQL_ADD).
+     */
+    void BulkAdd();
+
+    /**
+     * @brief Closes the cursor, discards the pending results of a batch and
+     * completes any open bulk load. This does _not_ un-prepare the statement or
+     * change bindings.
      */
     void closeCursor(bool suppressErrors);
 
@@ -101,6 +194,25 @@ class ODBCStatement : public ODBCHandle<ODBCStatement> {
     long GetUpdateCount();
 
   private:
+    /// A function started asynchronously and not yet polled to completion.
+    struct AsyncCall {
+      SQLUSMALLINT m_functionId;
+      std::thread m_worker;
+      SQLRETURN m_result = SQL_STILL_EXECUTING;
+      bool m_done = false;
+      bool m_cancelled = false;
+    };
+
+    SQLRETURN ExecuteAsync(SQLUSMALLINT functionId, std::function<SQLRETURN()> function);
+    void OpenCurrentResult(bool hasResultSet);
+    void DescribePrepared();
+    bool HasBoundParameters() const;
+    void PropagateParameterBindings();
+    void SetParameterStatuses(SQLULEN paramsetSize, SQLUSMALLINT status);
+    void PropagateBulkColumnBindings(bool fromCursor);
+    void SetRowStatuses(SQLULEN rowsetSize, SQLUSMALLINT status);
+    void CheckNoBulkLoadOpen() const;
+
     ODBCConnection& m_connection;
     std::shared_ptr<driver::odbcabstraction::Statement> m_spiStatement;
     std::shared_ptr<driver::odbcabstraction::ResultSet> m_currenResult;
@@ -115,7 +227,17 @@ class ODBCStatement : public ODBCHandle<ODBCStatement> {
     SQLULEN m_rowNumber;
     SQLULEN m_maxRows;
     SQLULEN m_rowsetSize; // Used by SQLExtendedFetch instead of the ARD array size.
+    size_t m_propagatedParameterCount; // Parameters last passed down to the SPI statement.
+    size_t m_propagatedBulkColumnCount; // Bulk load columns last passed down to the SPI statement.
+    std::string m_bulkLoadTable;
+    bool m_bulkLoadOpen; // Rows were added to m_bulkLoadTable and not flushed yet.
     bool m_isPrepared;
+    bool m_describePending; // The IRD does not describe the prepared statement yet.
     bool m_hasReachedEndOfResult;
+    SQLULEN m_asyncEnable; // Guarded by m_asyncMutex, like m_asyncCall.
+    std::mutex m_asyncMutex;
+    std::unique_ptr<AsyncCall> m_asyncCall;
+    // Errors of the calls rejected while m_asyncCall runs.
+    driver::odbcabstraction::Diagnostics m_asyncDiagnostics;
 };
 }
@@ -47,6 +47,8 @@ public:
     CURRENT_CATALOG,    // std::string - The current catalog
     LOGIN_TIMEOUT,      // uint32_t - The timeout for the initial connection
     PACKET_SIZE,        // uint32_t - The Packet Size
+    RESULT_CACHE_HITS,  // uint32_t - Queries answered by the result cache
+    RESULT_CACHE_MISSES, // uint32_t - Cacheable queries the result cache could not answer
   };
 
   typedef boost::variant<std::string, void*, uint64_t, uint32_t>  Attribute;
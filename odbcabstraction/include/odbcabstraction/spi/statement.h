@@ -10,8 +10,11 @@
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 #include <map>
+#include <memory>
 #include <vector>
 
+#include <odbcabstraction/platform.h>
+
 namespace driver {
 namespace odbcabstraction {
 
@@ -36,6 +39,14 @@ public:
     METADATA_ID,    // size_t - Modifies catalog function arguments to be identifiers. SQL_TRUE or SQL_FALSE.
     NOSCAN,         // size_t - Indicates that the driver does not scan for escape sequences. Default to SQL_NOSCAN_OFF
     QUERY_TIMEOUT,  // size_t - The time to wait in seconds for queries to execute. 0 to have no timeout.
+    QUERY_PROGRESS, // size_t - Percentage of the last query the server completed. Read-only.
+    EXECUTE_MODE,   // size_t - How statements are executed, one of ExecuteMode. Default to EXECUTE_AUTO.
+  };
+
+  enum ExecuteMode {
+    EXECUTE_AUTO,   // Statements that only change data or schema objects run as updates.
+    EXECUTE_QUERY,  // Every statement returns a result set.
+    EXECUTE_UPDATE, // Every statement runs as an update, returning only a row count.
   };
 
   typedef boost::variant<size_t> Attribute;
@@ -62,19 +73,103 @@ public:
 
   /// \brief Prepares the statement.
   /// Returns ResultSetMetadata if query returns a result set,
-  /// otherwise it returns `boost::none`.
+  /// otherwise it returns `boost::none`. It also returns `boost::none` when
+  /// preparing is deferred until `DescribePrepared`, `GetParameterMetadata` or
+  /// an execution needs it.
   /// \param query The SQL query to prepare.
   virtual boost::optional<std::shared_ptr<ResultSetMetadata>>
   Prepare(const std::string &query) = 0;
 
-  /// \brief Execute the prepared statement.
+  /// \brief Describes the result set of the prepared statement, completing a
+  /// deferred preparation first.
+  /// Returns ResultSetMetadata if query returns a result set,
+  /// otherwise it returns `boost::none`.
   ///
   /// NOTE: Must call `Prepare(const std::string &query)` before, otherwise it
   /// will throw an exception.
+  virtual boost::optional<std::shared_ptr<ResultSetMetadata>> DescribePrepared() = 0;
+
+  /// \brief Returns metadata describing the parameter markers of the prepared
+  /// statement, one column per parameter.
+  ///
+  /// NOTE: Must call `Prepare(const std::string &query)` before, otherwise it
+  /// will throw an exception.
+  virtual std::shared_ptr<ResultSetMetadata> GetParameterMetadata() = 0;
+
+  /// \brief Binds an application buffer as the source of an input parameter.
+  /// Bindings survive re-preparing the statement. Passing null for both
+  /// `buffer` and `strlen_buffer` unbinds the parameter.
+  ///
+  /// \param parameter Parameter number to be bound with (starts from 1).
+  /// \param c_type Data type of the application buffer.
+  /// \param sql_type Data type of the parameter declared by the application.
+  /// \param precision Parameter's column size.
+  /// \param scale Parameter's decimal digits.
+  /// \param buffer Buffer holding the parameter values.
+  /// \param buffer_length Length of a single character or binary value.
+  /// \param strlen_buffer Buffer that holds the length or NULL indicator of
+  /// each value contained on `buffer`.
+  virtual void BindParameter(int parameter, int16_t c_type, int16_t sql_type,
+                             int precision, int scale, void *buffer,
+                             size_t buffer_length, ssize_t *strlen_buffer) = 0;
+
+  /// \brief Execute the prepared statement once for every parameter set held
+  /// by the buffers previously bound with `BindParameter`.
   ///
+  /// NOTE: Must call `Prepare(const std::string &query)` before, otherwise it
+  /// will throw an exception.
+  ///
+  /// \param paramset_size The number of parameter sets in the bound buffers.
+  /// \param bind_offset The offset for bound parameters and indicators.
+  /// \param bind_type The type of binding. Zero indicates columnar binding, non-zero indicates
+  ///                  that this holds the size of an application row buffer. This corresponds
+  ///                  directly to SQL_DESC_BIND_TYPE in ODBC.
+  /// \param operation_array Optional array marking parameter sets to skip.
   /// \returns true if the first result is a ResultSet object;
   ///         false if it is an update count or there are no results.
-  virtual bool ExecutePrepared() = 0;
+  virtual bool ExecutePrepared(size_t paramset_size, size_t bind_offset,
+                               size_t bind_type,
+                               const uint16_t *operation_array) = 0;
+
+  /// \brief Binds an application buffer as the source of a column appended
+  /// with `BulkAdd`. Passing null for both `buffer` and `strlen_buffer`
+  /// unbinds the column.
+  ///
+  /// \param column Column number to be bound with (starts from 1).
+  /// \param column_name Name of the target table column. When empty, the
+  /// table column at the same position is used.
+  /// \param c_type Data type of the application buffer.
+  /// \param precision Column's precision.
+  /// \param scale Column's scale.
+  /// \param buffer Buffer holding the column values.
+  /// \param buffer_length Length of a single character or binary value.
+  /// \param strlen_buffer Buffer that holds the length or NULL indicator of
+  /// each value contained on `buffer`.
+  virtual void BindBulkColumn(int column, const std::string &column_name, int16_t c_type,
+                              int precision, int scale, void *buffer, size_t buffer_length,
+                              ssize_t *strlen_buffer) = 0;
+
+  /// \brief Appends the rows held by the buffers bound with `BindBulkColumn`
+  /// to an existing table. Rows are streamed to the server as part of a bulk
+  /// load that stays open until `FinishBulkLoad` is called. Changing the
+  /// target table or the bound columns finishes the open load first.
+  ///
+  /// \param catalog_name The catalog of the table, may be null.
+  /// \param schema_name The schema of the table, may be null.
+  /// \param table_name The table to append to.
+  /// \param rows The number of rows in the bound buffers.
+  /// \param bind_offset The offset for bound columns and indicators.
+  /// \param bind_type Zero for column-wise binding, otherwise the size of an
+  ///                  application row buffer.
+  /// \param operation_array Optional array marking rows to skip.
+  /// \returns the number of rows added to the load.
+  virtual size_t BulkAdd(const std::string *catalog_name, const std::string *schema_name,
+                         const std::string &table_name, size_t rows, size_t bind_offset,
+                         size_t bind_type, const uint16_t *operation_array) = 0;
+
+  /// \brief Completes the open bulk load, if any, once the server stored
+  /// every row. The number of rows loaded becomes the update count.
+  virtual void FinishBulkLoad() = 0;
 
   /// \brief Execute the statement if it is prepared or not.
   /// \param query The SQL query to execute.
@@ -90,6 +185,15 @@ public:
   /// returned.
   virtual long GetUpdateCount() = 0;
 
+  /// \brief Moves to the results of the next statement of the batch passed to
+  /// `Execute`, which then become the current result.
+  /// \returns false when every statement of the batch was already returned.
+  virtual bool NextResult() = 0;
+
+  /// \brief Drops the statements of the batch `NextResult` did not reach, so
+  /// they are not executed.
+  virtual void DiscardPendingResults() = 0;
+
   /// \brief Returns the list of table, catalog, or schema names, and table
   /// types, stored in a specific data source. The driver returns the
   /// information as a result set.
@@ -198,6 +302,15 @@ public:
 
   /// \brief Cancels the processing of this statement.
   virtual void Cancel() = 0;
+
+  /// \brief Makes the server calls this statement has in progress fail as
+  /// soon as possible. Unlike `Cancel`, it is safe to call while another
+  /// thread runs a method of this statement. Server calls keep failing until
+  /// `ClearInterrupt` is called.
+  virtual void Interrupt() = 0;
+
+  /// \brief Lets server calls run again after `Interrupt`.
+  virtual void ClearInterrupt() = 0;
 };
 
 } // namespace odbcabstraction
@@ -94,7 +94,21 @@ enum CDataType {
   CDataType_SBIGINT = ((-5) + (-20)),
   CDataType_UBIGINT = ((-5) + (-22)),
   CDataType_BINARY = (-2),
+  CDataType_GUID = (-11),
   CDataType_NUMERIC = 2,
+  CDataType_INTERVAL_YEAR = (100 + 1),
+  CDataType_INTERVAL_MONTH = (100 + 2),
+  CDataType_INTERVAL_DAY = (100 + 3),
+  CDataType_INTERVAL_HOUR = (100 + 4),
+  CDataType_INTERVAL_MINUTE = (100 + 5),
+  CDataType_INTERVAL_SECOND = (100 + 6),
+  CDataType_INTERVAL_YEAR_TO_MONTH = (100 + 7),
+  CDataType_INTERVAL_DAY_TO_HOUR = (100 + 8),
+  CDataType_INTERVAL_DAY_TO_MINUTE = (100 + 9),
+  CDataType_INTERVAL_DAY_TO_SECOND = (100 + 10),
+  CDataType_INTERVAL_HOUR_TO_MINUTE = (100 + 11),
+  CDataType_INTERVAL_HOUR_TO_SECOND = (100 + 12),
+  CDataType_INTERVAL_MINUTE_TO_SECOND = (100 + 13),
   CDataType_DEFAULT = 99,
 };
 
@@ -170,6 +184,13 @@ struct MetadataSettings {
   bool use_wide_char_;
   bool use_extended_flightsql_buffer_;
   bool hide_sql_tables_listing_;
+  size_t conversion_threads_{1};
+  size_t conversion_tile_rows_{0};
+  bool conversion_tiles_from_cache_{false};
+  size_t ingest_batch_rows_{65536};
+  size_t ingest_buffer_capacity_{4};
+  bool use_poll_flight_info_{false};
+  bool defer_prepare_{false};
 };
 
 } // namespace odbcabstraction
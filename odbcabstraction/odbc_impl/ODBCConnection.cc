@@ -131,18 +131,20 @@ void ODBCConnection::GetInfo(SQLUSMALLINT infoType, SQLPOINTER value, SQLSMALLIN
       break;
     #endif
     case SQL_ASYNC_MODE:
-      GetAttribute(static_cast<SQLUINTEGER>(SQL_AM_NONE), value, bufferLength, outputLength);
+      GetAttribute(static_cast<SQLUINTEGER>(SQL_AM_STATEMENT), value, bufferLength, outputLength);
       break;
     #ifdef SQL_ASYNC_NOTIFICATION
     case SQL_ASYNC_NOTIFICATION:
       GetAttribute(static_cast<SQLUINTEGER>(SQL_ASYNC_NOTIFICATION_NOT_CAPABLE), value, bufferLength, outputLength);
       break;
     #endif
+    // Each statement of a batch has its own result set or row count, returned by SQLMoreResults.
     case SQL_BATCH_ROW_COUNT:
-      GetAttribute(static_cast<SQLUINTEGER>(0), value, bufferLength, outputLength);
+      GetAttribute(static_cast<SQLUINTEGER>(SQL_BRC_EXPLICIT), value, bufferLength, outputLength);
       break;
     case SQL_BATCH_SUPPORT:
-      GetAttribute(static_cast<SQLUINTEGER>(0), value, bufferLength, outputLength);
+      GetAttribute(static_cast<SQLUINTEGER>(SQL_BS_SELECT_EXPLICIT | SQL_BS_ROW_COUNT_EXPLICIT), value,
+                   bufferLength, outputLength);
       break;
     case SQL_DATA_SOURCE_NAME:
       GetStringAttribute(isUnicode, m_dsn, true, value, bufferLength, outputLength, GetDiagnostics());
@@ -157,7 +159,7 @@ void ODBCConnection::GetInfo(SQLUSMALLINT infoType, SQLPOINTER value, SQLSMALLIN
       GetAttribute(static_cast<SQLUINTEGER>(0), value, bufferLength, outputLength);
       break;
     case SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES1:
-      GetAttribute(static_cast<SQLUINTEGER>(SQL_CA1_NEXT), value, bufferLength, outputLength);
+      GetAttribute(static_cast<SQLUINTEGER>(SQL_CA1_NEXT | SQL_CA1_BULK_ADD), value, bufferLength, outputLength);
       break;
     case SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES2:
       GetAttribute(static_cast<SQLUINTEGER>(SQL_CA2_READ_ONLY_CONCURRENCY), value, bufferLength, outputLength);
@@ -204,7 +206,7 @@ void ODBCConnection::GetInfo(SQLUSMALLINT infoType, SQLPOINTER value, SQLSMALLIN
       GetStringAttribute(isUnicode, "N", true, value, bufferLength, outputLength, GetDiagnostics());
       break;
     case SQL_MULT_RESULT_SETS:
-      GetStringAttribute(isUnicode, "N", true, value, bufferLength, outputLength, GetDiagnostics());
+      GetStringAttribute(isUnicode, "Y", true, value, bufferLength, outputLength, GetDiagnostics());
       break;
     case SQL_MULTIPLE_ACTIVE_TXN:
       GetStringAttribute(isUnicode, "N", true, value, bufferLength, outputLength, GetDiagnostics());
@@ -492,6 +494,18 @@ void ODBCConnection::SetConnectAttr(SQLINTEGER attribute, SQLPOINTER value, SQLI
   // SQL_ATTR_ROW_NUMBER is excluded because it is read-only.
   // Note that SQLGetConnectAttr cannot retrieve these attributes.
   case SQL_ATTR_ASYNC_ENABLE:
+    // Unlike the others, it also applies to the statements allocated already.
+    for (const auto& statement : m_statements) {
+      if (statement->IsExecutingAsync()) {
+        throw DriverException("Function sequence error", "HY010");
+      }
+    }
+    m_attributeTrackingStatement->SetStmtAttr(attribute, value, stringLength, isUnicode);
+    for (const auto& statement : m_statements) {
+      statement->SetStmtAttr(attribute, value, stringLength, isUnicode);
+    }
+    return;
+
   case SQL_ATTR_METADATA_ID:
   case SQL_ATTR_CONCURRENCY:
   case SQL_ATTR_CURSOR_TYPE:
@@ -523,6 +537,9 @@ void ODBCConnection::SetConnectAttr(SQLINTEGER attribute, SQLPOINTER value, SQLI
     SetAttribute(value, attributeToWrite);
     successfully_written = m_spiConnection->SetAttribute(Connection::PACKET_SIZE, attributeToWrite);
     break;
+  case SQL_ATTR_GIZMOSQL_RESULT_CACHE_HITS:
+  case SQL_ATTR_GIZMOSQL_RESULT_CACHE_MISSES:
+    throw DriverException("Cannot set read-only attribute", "HY092");
   default:
     throw DriverException("Invalid attribute: " + std::to_string(attribute), "HY092");
   }
@@ -561,7 +578,8 @@ void ODBCConnection::GetConnectAttr(SQLINTEGER attribute, SQLPOINTER value,
     return;
 #endif
   case SQL_ATTR_ASYNC_ENABLE:
-    GetAttribute(static_cast<SQLULEN>(SQL_ASYNC_ENABLE_OFF), value, bufferLength, outputLength);
+    // New statements take the value set through the connection.
+    m_attributeTrackingStatement->GetStmtAttr(attribute, value, bufferLength, outputLength, isUnicode);
     return;
   case SQL_ATTR_AUTO_IPD:
     GetAttribute(static_cast<SQLUINTEGER>(SQL_FALSE), value, bufferLength, outputLength);
@@ -621,6 +639,12 @@ void ODBCConnection::GetConnectAttr(SQLINTEGER attribute, SQLPOINTER value,
   case SQL_ATTR_PACKET_SIZE:
     spiAttribute = m_spiConnection->GetAttribute(Connection::PACKET_SIZE);
     break;
+  case SQL_ATTR_GIZMOSQL_RESULT_CACHE_HITS:
+    spiAttribute = m_spiConnection->GetAttribute(Connection::RESULT_CACHE_HITS);
+    break;
+  case SQL_ATTR_GIZMOSQL_RESULT_CACHE_MISSES:
+    spiAttribute = m_spiConnection->GetAttribute(Connection::RESULT_CACHE_MISSES);
+    break;
   default:
     throw DriverException("Invalid attribute", "HY092");
   }
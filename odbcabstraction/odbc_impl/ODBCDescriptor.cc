@@ -512,6 +512,31 @@ void ODBCDescriptor::BindCol(SQLSMALLINT recordNumber, SQLSMALLINT cType, SQLPOI
   SetDataPtrOnRecord(dataPtr, recordNumber);
 }
 
+void ODBCDescriptor::BindParameterType(SQLSMALLINT recordNumber, SQLSMALLINT ioType, SQLSMALLINT sqlType,
+                                       SQLULEN columnSize, SQLSMALLINT decimalDigits) {
+  assert(!m_isAppDescriptor);
+  assert(m_isWritable);
+
+  // The set of records auto-expands to the supplied record number.
+  if (m_records.size() < recordNumber) {
+    m_records.resize(recordNumber);
+  }
+
+  DescriptorRecord& record = m_records[recordNumber - 1];
+  record.m_paramType = ioType;
+  record.m_type = sqlType;
+  record.m_conciseType = sqlType;
+  record.m_length = columnSize;
+  record.m_precision = static_cast<SQLSMALLINT>(columnSize);
+  record.m_scale = decimalDigits;
+  record.m_isBound = true;
+
+  if (m_highestOneBasedBoundRecord < recordNumber) {
+    m_highestOneBasedBoundRecord = recordNumber;
+  }
+  m_hasBindingsChanged = true;
+}
+
 void ODBCDescriptor::SetDataPtrOnRecord(SQLPOINTER dataPtr, SQLSMALLINT recordNumber) {
   assert(recordNumber <= m_records.size());
   DescriptorRecord& record = m_records[recordNumber-1];
@@ -11,6 +11,7 @@
 #include <odbcabstraction/odbc_impl/AttributeUtils.h>
 #include <odbcabstraction/odbc_impl/ODBCConnection.h>
 #include <odbcabstraction/odbc_impl/ODBCDescriptor.h>
+#include <odbcabstraction/odbc_impl/TypeUtilities.h>
 #include <sql.h>
 #include <sqlext.h>
 #include <sqltypes.h>
@@ -20,7 +21,10 @@
 #include <odbcabstraction/spi/result_set_metadata.h>
 #include <odbcabstraction/types.h>
 #include <boost/optional.hpp>
+#include <algorithm>
+#include <string>
 #include <utility>
+#include <vector>
 #include <boost/variant.hpp>
 
 using namespace ODBC;
@@ -69,6 +73,9 @@ namespace {
       case SQL_C_NUMERIC:
         return sizeof(SQL_NUMERIC_STRUCT);
 
+      case SQL_C_GUID:
+        return sizeof(SQLGUID);
+
       case SQL_C_DATE:
       case SQL_C_TYPE_DATE:
         return sizeof(SQL_DATE_STRUCT);
@@ -117,6 +124,9 @@ namespace {
       case SQL_LONGVARBINARY:
         return SQL_C_BINARY;
 
+      case SQL_GUID:
+        return SQL_C_GUID;
+
       case SQL_TINYINT:
         return record.m_unsigned ? SQL_C_UTINYINT : SQL_C_STINYINT;
       
@@ -180,6 +190,25 @@ namespace {
     }
   }
 
+  /// Splits "table", "schema.table" or "catalog.schema.table" into its parts.
+  void ParseBulkLoadTable(const std::string& name, std::string& catalog, std::string& schema,
+                          std::string& table) {
+    std::vector<std::string> parts;
+    size_t start = 0;
+    for (size_t dot = name.find('.'); dot != std::string::npos; dot = name.find('.', start)) {
+      parts.push_back(name.substr(start, dot - start));
+      start = dot + 1;
+    }
+    parts.push_back(name.substr(start));
+
+    if (parts.size() > 3 || parts.back().empty()) {
+      throw DriverException("Invalid bulk load table name: " + name, "HY024");
+    }
+    table = parts.back();
+    schema = parts.size() >= 2 ? parts[parts.size() - 2] : "";
+    catalog = parts.size() == 3 ? parts[0] : "";
+  }
+
   void CopyAttribute(Statement& source, Statement& target, Statement::StatementAttributeId attributeId) {
     auto optionalValue = source.GetAttribute(attributeId);
     if (optionalValue) {
@@ -198,19 +227,105 @@ ODBCStatement::ODBCStatement(ODBCConnection& connection,
   m_builtInApd(std::make_shared<ODBCDescriptor>(m_spiStatement->GetDiagnostics(), nullptr, this, true, true, connection.IsOdbc2Connection())),
   m_ipd(std::make_shared<ODBCDescriptor>(m_spiStatement->GetDiagnostics(), nullptr, this, false, true, connection.IsOdbc2Connection())),
   m_ird(std::make_shared<ODBCDescriptor>(m_spiStatement->GetDiagnostics(), nullptr, this, false, false, connection.IsOdbc2Connection())),
-  m_currentArd(m_builtInApd.get()),
+  m_currentArd(m_builtInArd.get()),
   m_currentApd(m_builtInApd.get()),
   m_rowNumber(0),
   m_maxRows(0),
   m_rowsetSize(1),
+  m_propagatedParameterCount(0),
+  m_propagatedBulkColumnCount(0),
+  m_bulkLoadOpen(false),
   m_isPrepared(false),
-  m_hasReachedEndOfResult(false) {
+  m_describePending(false),
+  m_hasReachedEndOfResult(false),
+  m_asyncEnable(SQL_ASYNC_ENABLE_OFF),
+  m_asyncDiagnostics(m_diagnostics->GetVendor(), m_diagnostics->GetDataSourceComponent(),
+                     m_diagnostics->GetOdbcVersion()) {
+}
+
+ODBCStatement::~ODBCStatement() {
+  // An asynchronous function nobody polled to completion still uses this statement.
+  if (m_asyncCall) {
+    m_spiStatement->Interrupt();
+    m_asyncCall->m_worker.join();
+  }
 }
 
 ODBCConnection &ODBCStatement::GetConnection() {
   return m_connection;
 }
 
+bool ODBCStatement::IsExecutingAsync() {
+  std::lock_guard<std::mutex> lock(m_asyncMutex);
+  return m_asyncCall != nullptr;
+}
+
+driver::odbcabstraction::Diagnostics& ODBCStatement::GetReportedDiagnostics() {
+  std::lock_guard<std::mutex> lock(m_asyncMutex);
+  return m_asyncCall ? m_asyncDiagnostics : GetDiagnostics();
+}
+
+bool ODBCStatement::CancelAsync() {
+  std::lock_guard<std::mutex> lock(m_asyncMutex);
+  if (!m_asyncCall) {
+    return false;
+  }
+
+  // A function that already completed reports its own outcome.
+  if (!m_asyncCall->m_done) {
+    m_asyncCall->m_cancelled = true;
+    m_spiStatement->Interrupt();
+  }
+  return true;
+}
+
+SQLRETURN ODBCStatement::ExecuteAsync(SQLUSMALLINT functionId, std::function<SQLRETURN()> function) {
+  std::unique_lock<std::mutex> lock(m_asyncMutex);
+  if (!m_asyncCall) {
+    if (m_asyncEnable == SQL_ASYNC_ENABLE_OFF) {
+      lock.unlock();
+      return executeWithLock(SQL_SUCCESS, function);
+    }
+
+    // The worker holds the handle lock, so synchronous calls on this statement wait for it
+    // instead of racing with it.
+    m_asyncDiagnostics.Clear();
+    m_asyncCall.reset(new AsyncCall());
+    m_asyncCall->m_functionId = functionId;
+    m_asyncCall->m_worker = std::thread([this, function = std::move(function)] {
+      SQLRETURN result = executeWithLock(SQL_SUCCESS, function);
+
+      std::lock_guard<std::mutex> lock(m_asyncMutex);
+      m_asyncCall->m_result = result;
+      m_asyncCall->m_done = true;
+    });
+    return SQL_STILL_EXECUTING;
+  }
+
+  if (m_asyncCall->m_functionId != functionId) {
+    // The running function still records its own diagnostics, so the error is kept apart.
+    m_asyncDiagnostics.Clear();
+    m_asyncDiagnostics.AddError(DriverException("Function sequence error", "HY010"));
+    return SQL_ERROR;
+  }
+  if (!m_asyncCall->m_done) {
+    return SQL_STILL_EXECUTING;
+  }
+
+  std::unique_ptr<AsyncCall> call = std::move(m_asyncCall);
+  lock.unlock();
+  call->m_worker.join();
+
+  if (call->m_cancelled) {
+    return executeWithLock(SQL_ERROR, [this]() -> SQLRETURN {
+      m_spiStatement->ClearInterrupt();
+      closeCursor(true);
+      throw DriverException("Operation canceled", "HY008");
+    });
+  }
+  return call->m_result;
+}
+
 void ODBCStatement::CopyAttributesFromConnection(ODBCConnection& connection) {
   ODBCStatement& trackingStatement = connection.GetTrackingStatement();
 
@@ -233,6 +348,15 @@ void ODBCStatement::CopyAttributesFromConnection(ODBCConnection& connection) {
   CopyAttribute(*trackingStatement.m_spiStatement, *m_spiStatement, Statement::MAX_LENGTH);
   CopyAttribute(*trackingStatement.m_spiStatement, *m_spiStatement, Statement::NOSCAN);
   CopyAttribute(*trackingStatement.m_spiStatement, *m_spiStatement, Statement::QUERY_TIMEOUT);
+  SQLULEN asyncEnable;
+  {
+    std::lock_guard<std::mutex> lock(trackingStatement.m_asyncMutex);
+    asyncEnable = trackingStatement.m_asyncEnable;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    m_asyncEnable = asyncEnable;
+  }
 
   // SQL_ATTR_ROW_BIND_TYPE:
   m_currentArd->SetHeaderField(SQL_DESC_BIND_TYPE,
@@ -244,38 +368,97 @@ bool ODBCStatement::isPrepared() const {
 }
 
 void ODBCStatement::Prepare(const std::string& query) {
+  CheckNoBulkLoadOpen();
   boost::optional<std::shared_ptr<ResultSetMetadata> > metadata = m_spiStatement->Prepare(query);
 
   if (metadata) {
     m_ird->PopulateFromResultSetMetadata(metadata->get());
   }
   m_isPrepared = true;
+  // Without metadata, the statement is described once the IRD is needed.
+  m_describePending = !metadata;
+}
+
+void ODBCStatement::DescribePrepared() {
+  if (!m_isPrepared || !m_describePending) {
+    return;
+  }
+
+  boost::optional<std::shared_ptr<ResultSetMetadata> > metadata = m_spiStatement->DescribePrepared();
+  if (metadata) {
+    m_ird->PopulateFromResultSetMetadata(metadata->get());
+  }
+  m_describePending = false;
+}
+
+ODBCDescriptor* ODBCStatement::GetIRD() {
+  DescribePrepared();
+  return m_ird.get();
 }
 
 void ODBCStatement::ExecutePrepared() {
   if (!m_isPrepared) {
     throw DriverException("Function sequence error", "HY010");
   }
-
-  if (m_spiStatement->ExecutePrepared()) {
-    m_currenResult = m_spiStatement->GetResultSet();
-    m_ird->PopulateFromResultSetMetadata(m_spiStatement->GetResultSet()->GetMetadata().get());
-    m_hasReachedEndOfResult = false;
+  CheckNoBulkLoadOpen();
+
+  PropagateParameterBindings();
+
+  // Every parameter set is sent at once, so all of them share one outcome.
+  const SQLULEN paramsetSize = m_propagatedParameterCount ? m_currentApd->GetArraySize() : 1;
+  bool hasResultSet;
+  try {
+    hasResultSet = m_spiStatement->ExecutePrepared(paramsetSize, m_currentApd->GetBindOffset(),
+                                                   m_currentApd->GetBoundStructOffset(),
+                                                   m_currentApd->GetArrayStatusPtr());
+  } catch (...) {
+    SetParameterStatuses(paramsetSize, SQL_PARAM_ERROR);
+    throw;
   }
+  SetParameterStatuses(paramsetSize, SQL_PARAM_SUCCESS);
+
+  OpenCurrentResult(hasResultSet);
 }
 
 void ODBCStatement::ExecuteDirect(const std::string& query) {
-  if (m_spiStatement->Execute(query)) {
-    m_currenResult = m_spiStatement->GetResultSet();
-    m_ird->PopulateFromResultSetMetadata(m_currenResult->GetMetadata().get());
-    m_hasReachedEndOfResult = false;
+  CheckNoBulkLoadOpen();
+
+  // Parameter values can only travel with a prepared statement.
+  if (HasBoundParameters()) {
+    Prepare(query);
+    ExecutePrepared();
+    m_isPrepared = false;
+    return;
   }
 
+  OpenCurrentResult(m_spiStatement->Execute(query));
+
   // Direct execution wipes out the prepared state.
   m_isPrepared = false;
 }
 
+bool ODBCStatement::MoreResults() {
+  if (m_currenResult) {
+    m_currenResult->Close();
+    m_currenResult = nullptr;
+  }
+  m_currentArd->NotifyBindingsHaveChanged();
+  m_rowNumber = 0;
+  m_hasReachedEndOfResult = false;
+
+  if (!m_spiStatement->NextResult()) {
+    return false;
+  }
+
+  OpenCurrentResult(m_spiStatement->GetResultSet() != nullptr);
+  return true;
+}
+
 bool ODBCStatement::Fetch(size_t rows) {
+  if (!m_currenResult) {
+    throw DriverException("Invalid cursor state", "24000");
+  }
+
   if (m_hasReachedEndOfResult) {
     m_ird->SetRowsProcessed(0);
     return false;
@@ -331,7 +514,7 @@ void ODBCStatement::GetStmtAttr(SQLINTEGER statementAttribute,
       DescriptorToHandle(output, m_ipd.get(), strLenPtr);
       return;
     case SQL_ATTR_IMP_ROW_DESC:
-      DescriptorToHandle(output, m_ird.get(), strLenPtr);
+      DescriptorToHandle(output, GetIRD(), strLenPtr);
       return;
 
     // Attributes that are descriptor fields
@@ -372,8 +555,18 @@ void ODBCStatement::GetStmtAttr(SQLINTEGER statementAttribute,
       m_ird->GetHeaderField(SQL_DESC_ROWS_PROCESSED_PTR, output, bufferSize, strLenPtr);
       return;
 
-    case SQL_ATTR_ASYNC_ENABLE:
-      GetAttribute(static_cast<SQLULEN>(SQL_ASYNC_ENABLE_OFF), output, bufferSize, strLenPtr);
+    case SQL_ATTR_ASYNC_ENABLE: {
+      SQLULEN asyncEnable;
+      {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        asyncEnable = m_asyncEnable;
+      }
+      GetAttribute(asyncEnable, output, bufferSize, strLenPtr);
+      return;
+    }
+
+    case SQL_ATTR_GIZMOSQL_BULK_LOAD_TABLE:
+      GetStringAttribute(isUnicode, m_bulkLoadTable, true, output, bufferSize, strLenPtr, GetDiagnostics());
       return;
 
 #ifdef SQL_ATTR_ASYNC_STMT_EVENT
@@ -447,6 +640,12 @@ void ODBCStatement::GetStmtAttr(SQLINTEGER statementAttribute,
     case SQL_ATTR_QUERY_TIMEOUT:
       spiAttribute = m_spiStatement->GetAttribute(Statement::QUERY_TIMEOUT);
       break;
+    case SQL_ATTR_GIZMOSQL_QUERY_PROGRESS:
+      spiAttribute = m_spiStatement->GetAttribute(Statement::QUERY_PROGRESS);
+      break;
+    case SQL_ATTR_GIZMOSQL_EXECUTE_MODE:
+      spiAttribute = m_spiStatement->GetAttribute(Statement::EXECUTE_MODE);
+      break;
     default:
       throw DriverException("Invalid statement attribute: " + std::to_string(statementAttribute), "HY092");
   }
@@ -534,7 +733,16 @@ void ODBCStatement::SetStmtAttr(SQLINTEGER statementAttribute, SQLPOINTER value,
       m_ird->SetHeaderField(SQL_DESC_ROWS_PROCESSED_PTR, value, bufferSize);
       return;
 
-    case SQL_ATTR_ASYNC_ENABLE:
+    case SQL_ATTR_ASYNC_ENABLE: {
+      SQLULEN asyncEnable = 0;
+      SetAttribute(value, asyncEnable);
+      if (asyncEnable != SQL_ASYNC_ENABLE_OFF && asyncEnable != SQL_ASYNC_ENABLE_ON) {
+        throw DriverException("Invalid attribute value", "HY024");
+      }
+      std::lock_guard<std::mutex> lock(m_asyncMutex);
+      m_asyncEnable = asyncEnable;
+      return;
+    }
 #ifdef SQL_ATTR_ASYNC_STMT_EVENT
     case SQL_ATTR_ASYNC_STMT_EVENT:
       throw DriverException("Unsupported attribute", "HYC00");
@@ -585,7 +793,27 @@ void ODBCStatement::SetStmtAttr(SQLINTEGER statementAttribute, SQLPOINTER value,
       SetAttribute(value, m_rowsetSize);
       return;
 
+    case SQL_ATTR_GIZMOSQL_BULK_LOAD_TABLE: {
+      std::string table;
+      if (value) {
+        if (isUnicode) {
+          SetAttributeSQLWCHAR(value, bufferSize, table);
+        } else {
+          SetAttributeUTF8(value, bufferSize, table);
+        }
+      }
+      if (table != m_bulkLoadTable) {
+        // Changing the table flushes the open load: the server errors are
+        // returned here and the rows stored become the row count.
+        m_bulkLoadTable = std::move(table);
+        m_bulkLoadOpen = false;
+        m_spiStatement->FinishBulkLoad();
+      }
+      return;
+    }
+
     case SQL_ATTR_MAX_ROWS:
+    case SQL_ATTR_GIZMOSQL_QUERY_PROGRESS:
       throw DriverException("Cannot set read-only attribute", "HY092");
 
     // Driver-leve statement attributes. These are all size_t attributes
@@ -605,6 +833,10 @@ void ODBCStatement::SetStmtAttr(SQLINTEGER statementAttribute, SQLPOINTER value,
       SetAttribute(value, attributeToWrite);
       successfully_written = m_spiStatement->SetAttribute(Statement::QUERY_TIMEOUT, attributeToWrite);
       break;
+    case SQL_ATTR_GIZMOSQL_EXECUTE_MODE:
+      SetAttribute(value, attributeToWrite);
+      successfully_written = m_spiStatement->SetAttribute(Statement::EXECUTE_MODE, attributeToWrite);
+      break;
     default:
         throw DriverException("Invalid attribute: " + std::to_string(attributeToWrite), "HY092");
   }
@@ -622,6 +854,10 @@ void ODBCStatement::RevertAppDescriptor(bool isApd) {
 }
 
 void ODBCStatement::closeCursor(bool suppressErrors) {
+  // An open bulk load is not part of the cursor: it is only flushed through
+  // SQL_ATTR_GIZMOSQL_BULK_LOAD_TABLE, and abandoned if the statement is freed.
+  m_spiStatement->DiscardPendingResults();
+
   if (!suppressErrors && !m_currenResult) {
     throw DriverException("Invalid cursor state", "28000");
   }
@@ -677,6 +913,107 @@ bool ODBCStatement::GetData(SQLSMALLINT recordNumber, SQLSMALLINT cType, SQLPOIN
                        scale, dataPtr, bufferLength, indicatorPtr);
 }
 
+void ODBCStatement::BindParameter(SQLUSMALLINT parameterNumber, SQLSMALLINT ioType, SQLSMALLINT cType,
+                                  SQLSMALLINT sqlType, SQLULEN columnSize, SQLSMALLINT decimalDigits,
+                                  SQLPOINTER dataPtr, SQLLEN bufferLength, SQLLEN* indicatorPtr) {
+  if (parameterNumber == 0) {
+    throw DriverException("Invalid descriptor index", "07009");
+  }
+  if (ioType != SQL_PARAM_INPUT) {
+    throw DriverException("Output parameters are not supported", "HYC00");
+  }
+
+  m_currentApd->BindCol(parameterNumber, cType, dataPtr, bufferLength, indicatorPtr);
+  m_ipd->BindParameterType(parameterNumber, ioType, sqlType, columnSize, decimalDigits);
+}
+
+void ODBCStatement::ResetParameters() {
+  m_currentApd->SetHeaderField(SQL_DESC_COUNT, reinterpret_cast<SQLPOINTER>(0), 0);
+  m_ipd->SetHeaderField(SQL_DESC_COUNT, reinterpret_cast<SQLPOINTER>(0), 0);
+}
+
+size_t ODBCStatement::GetParameterCount() {
+  if (!m_isPrepared) {
+    throw DriverException("Function sequence error", "HY010");
+  }
+  return m_spiStatement->GetParameterMetadata()->GetColumnCount();
+}
+
+void ODBCStatement::DescribeParameter(SQLUSMALLINT parameterNumber, SQLSMALLINT* dataType,
+                                      SQLULEN* parameterSize, SQLSMALLINT* decimalDigits,
+                                      SQLSMALLINT* nullable) {
+  if (!m_isPrepared) {
+    throw DriverException("Function sequence error", "HY010");
+  }
+
+  auto metadata = m_spiStatement->GetParameterMetadata();
+  if (parameterNumber == 0 || parameterNumber > metadata->GetColumnCount()) {
+    throw DriverException("Invalid descriptor index", "07009");
+  }
+
+  if (dataType) {
+    *dataType = GetSqlTypeForODBCVersion(metadata->GetConciseType(parameterNumber),
+                                         m_connection.IsOdbc2Connection());
+  }
+  if (parameterSize) *parameterSize = metadata->GetLength(parameterNumber);
+  if (decimalDigits) *decimalDigits = static_cast<SQLSMALLINT>(metadata->GetScale(parameterNumber));
+  if (nullable) *nullable = metadata->IsNullable(parameterNumber);
+}
+
+void ODBCStatement::BulkAdd() {
+  std::string catalog;
+  std::string schema;
+  std::string table;
+  const bool fromCursor = m_bulkLoadTable.empty();
+  if (!fromCursor) {
+    ParseBulkLoadTable(m_bulkLoadTable, catalog, schema, table);
+  } else {
+    // Without a target table, rows are added to the table the cursor reads from.
+    if (!m_currenResult) {
+      throw DriverException("Invalid cursor state", "24000");
+    }
+    const auto& irdRecords = m_ird->GetRecords();
+    if (!irdRecords.empty()) {
+      catalog = irdRecords[0].m_catalogName;
+      schema = irdRecords[0].m_schemaName;
+      table = irdRecords[0].m_baseTableName;
+    }
+    if (table.empty()) {
+      throw DriverException("The table of the result set is unknown. Name the table with "
+                            "SQL_ATTR_GIZMOSQL_BULK_LOAD_TABLE.", "HY000");
+    }
+  }
+
+  PropagateBulkColumnBindings(fromCursor);
+
+  const SQLULEN rowsetSize = m_currentArd->GetArraySize();
+  try {
+    m_spiStatement->BulkAdd(catalog.empty() ? nullptr : &catalog, schema.empty() ? nullptr : &schema,
+                            table, rowsetSize, m_currentArd->GetBindOffset(),
+                            m_currentArd->GetBoundStructOffset(), m_currentArd->GetArrayStatusPtr());
+    // Rows added through the cursor are stored before returning. A named target table
+    // keeps the load open so the following rowsets join the same stream.
+    if (fromCursor) {
+      m_spiStatement->FinishBulkLoad();
+    } else {
+      m_bulkLoadOpen = true;
+    }
+  } catch (...) {
+    SetRowStatuses(rowsetSize, SQL_ROW_ERROR);
+    throw;
+  }
+  SetRowStatuses(rowsetSize, SQL_ROW_ADDED);
+}
+
+void ODBCStatement::CheckNoBulkLoadOpen() const {
+  // Executing other statements before the load is stored would let them miss
+  // its rows, and its errors would be reported by an unrelated call.
+  if (m_bulkLoadOpen) {
+    throw DriverException("Function sequence error: a bulk load is open. Clear "
+                          "SQL_ATTR_GIZMOSQL_BULK_LOAD_TABLE to complete it first.", "HY010");
+  }
+}
+
 void ODBCStatement::releaseStatement() {
   closeCursor(true);
   // Note: dropStatement is intentionally NOT called here.
@@ -754,3 +1091,116 @@ void ODBCStatement::Cancel() {
 long ODBCStatement::GetUpdateCount() {
   return m_spiStatement->GetUpdateCount();
 }
+
+// Private =========================================================================================
+void ODBCStatement::OpenCurrentResult(bool hasResultSet) {
+  if (hasResultSet) {
+    m_currenResult = m_spiStatement->GetResultSet();
+    m_ird->PopulateFromResultSetMetadata(m_currenResult->GetMetadata().get());
+  } else {
+    // Only a row count was returned, so there are no columns to describe.
+    m_currenResult = nullptr;
+    m_ird->GetRecords().clear();
+  }
+  m_describePending = false;
+  m_hasReachedEndOfResult = false;
+}
+
+bool ODBCStatement::HasBoundParameters() const {
+  const auto& records = m_currentApd->GetRecords();
+  return std::any_of(records.begin(), records.end(), [](const DescriptorRecord& record) {
+    return record.m_dataPtr || record.m_indicatorPtr;
+  });
+}
+
+void ODBCStatement::PropagateParameterBindings() {
+  if (!m_currentApd->HaveBindingsChanged() && !m_ipd->HaveBindingsChanged()) {
+    return;
+  }
+
+  // A parameter bound with only an indicator still carries NULLs. Parameters
+  // propagated earlier but no longer in the APD get unbound.
+  const auto& apdRecords = m_currentApd->GetRecords();
+  const auto& ipdRecords = m_ipd->GetRecords();
+  const size_t count = std::max(apdRecords.size(), m_propagatedParameterCount);
+  m_propagatedParameterCount = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (i >= apdRecords.size() || !(apdRecords[i].m_dataPtr || apdRecords[i].m_indicatorPtr)) {
+      m_spiStatement->BindParameter(i + 1, SQL_C_DEFAULT, 0, 0, 0, nullptr, 0, nullptr);
+      continue;
+    }
+
+    const DescriptorRecord& apdRecord = apdRecords[i];
+    DescriptorRecord ipdRecord;
+    if (i < ipdRecords.size()) {
+      ipdRecord = ipdRecords[i];
+    } else {
+      ipdRecord.m_conciseType = SQL_VARCHAR;
+    }
+    const SQLSMALLINT cType =
+        apdRecord.m_type == SQL_C_DEFAULT ? getCTypeForSQLType(ipdRecord) : apdRecord.m_type;
+
+    m_spiStatement->BindParameter(i + 1, cType, ipdRecord.m_conciseType,
+                                  static_cast<int>(ipdRecord.m_length), ipdRecord.m_scale,
+                                  apdRecord.m_dataPtr, static_cast<size_t>(apdRecord.m_length),
+                                  apdRecord.m_indicatorPtr);
+    m_propagatedParameterCount = i + 1;
+  }
+
+  m_currentApd->NotifyBindingsHavePropagated();
+  m_ipd->NotifyBindingsHavePropagated();
+}
+
+void ODBCStatement::SetParameterStatuses(SQLULEN paramsetSize, SQLUSMALLINT status) {
+  SQLUSMALLINT* statuses = m_ipd->GetArrayStatusPtr();
+  const SQLUSMALLINT* operations = m_currentApd->GetArrayStatusPtr();
+  if (statuses) {
+    for (SQLULEN i = 0; i < paramsetSize; ++i) {
+      statuses[i] = operations && operations[i] == SQL_PARAM_IGNORE ? SQL_PARAM_UNUSED : status;
+    }
+  }
+  m_ipd->SetRowsProcessed(paramsetSize);
+}
+
+void ODBCStatement::PropagateBulkColumnBindings(bool fromCursor) {
+  // Columns read through a cursor map to table columns by name, otherwise by position.
+  const auto& ardRecords = m_currentArd->GetRecords();
+  const auto& irdRecords = m_ird->GetRecords();
+  const size_t count = std::max(ardRecords.size(), m_propagatedBulkColumnCount);
+  m_propagatedBulkColumnCount = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (i >= ardRecords.size() || !(ardRecords[i].m_dataPtr || ardRecords[i].m_indicatorPtr)) {
+      m_spiStatement->BindBulkColumn(i + 1, "", SQL_C_DEFAULT, 0, 0, nullptr, 0, nullptr);
+      continue;
+    }
+
+    const DescriptorRecord& ardRecord = ardRecords[i];
+    std::string columnName;
+    SQLSMALLINT cType = ardRecord.m_type;
+    if (fromCursor) {
+      if (i >= irdRecords.size()) {
+        throw DriverException("Invalid descriptor index", "07009");
+      }
+      columnName = irdRecords[i].m_baseColumnName;
+      if (cType == SQL_C_DEFAULT) {
+        cType = getCTypeForSQLType(irdRecords[i]);
+      }
+    }
+
+    m_spiStatement->BindBulkColumn(i + 1, columnName, cType, ardRecord.m_precision, ardRecord.m_scale,
+                                   ardRecord.m_dataPtr, GetLength(ardRecord), ardRecord.m_indicatorPtr);
+    m_propagatedBulkColumnCount = i + 1;
+  }
+}
+
+void ODBCStatement::SetRowStatuses(SQLULEN rowsetSize, SQLUSMALLINT status) {
+  SQLUSMALLINT* statuses = m_ird->GetArrayStatusPtr();
+  const SQLUSMALLINT* operations = m_currentArd->GetArrayStatusPtr();
+  if (statuses) {
+    for (SQLULEN i = 0; i < rowsetSize; ++i) {
+      if (!operations || operations[i] != SQL_ROW_IGNORE) {
+        statuses[i] = status;
+      }
+    }
+  }
+}
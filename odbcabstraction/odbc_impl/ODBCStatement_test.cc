@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2020-2022 Dremio Corporation
+ * Copyright (C) 2026 GizmoData LLC
+ *
+ * See "LICENSE" for license information.
+ */
+
+#include <odbcabstraction/odbc_impl/ODBCStatement.h>
+#include <odbcabstraction/odbc_impl/ODBCConnection.h>
+#include <odbcabstraction/odbc_impl/ODBCEnvironment.h>
+#include <odbcabstraction/exceptions.h>
+#include <odbcabstraction/spi/driver.h>
+#include <odbcabstraction/spi/statement.h>
+#include "gtest/gtest.h"
+#include <sqlext.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace ODBC {
+
+using namespace driver::odbcabstraction;
+
+namespace {
+
+class FakeDriver : public Driver {
+public:
+  FakeDriver() : diagnostics_("Fake", "Fake", V_3) {}
+
+  std::shared_ptr<Connection> CreateConnection(OdbcVersion) override { return nullptr; }
+  Diagnostics &GetDiagnostics() override { return diagnostics_; }
+  void SetVersion(std::string) override {}
+  void RegisterLog() override {}
+
+private:
+  Diagnostics diagnostics_;
+};
+
+/// Statement whose executions block until they are released or interrupted,
+/// and whose bulk loads only count the calls.
+class BlockingStatement : public Statement {
+public:
+  BlockingStatement() : diagnostics_("Fake", "Fake", V_3) {}
+
+  void Release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    released_ = true;
+    changed_.notify_all();
+  }
+
+  int finished_loads() const { return finished_loads_; }
+
+  bool interrupted() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return interrupted_;
+  }
+
+  bool Execute(const std::string &) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [this] { return released_ || interrupted_; });
+    if (interrupted_) {
+      throw DriverException("Operation canceled", "HY008");
+    }
+    return false;
+  }
+
+  void Interrupt() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    interrupted_ = true;
+    changed_.notify_all();
+  }
+
+  void ClearInterrupt() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    interrupted_ = false;
+  }
+
+  Diagnostics &GetDiagnostics() override { return diagnostics_; }
+  bool SetAttribute(StatementAttributeId, const Attribute &) override { return true; }
+  optional<Attribute> GetAttribute(StatementAttributeId) override { return boost::none; }
+  void FinishBulkLoad() override { ++finished_loads_; }
+  void DiscardPendingResults() override {}
+  void Cancel() override {}
+
+  boost::optional<std::shared_ptr<ResultSetMetadata>> Prepare(const std::string &) override {
+    throw DriverException("Not implemented");
+  }
+  boost::optional<std::shared_ptr<ResultSetMetadata>> DescribePrepared() override {
+    throw DriverException("Not implemented");
+  }
+  std::shared_ptr<ResultSetMetadata> GetParameterMetadata() override {
+    throw DriverException("Not implemented");
+  }
+  void BindParameter(int, int16_t, int16_t, int, int, void *, size_t, ssize_t *) override {
+    throw DriverException("Not implemented");
+  }
+  bool ExecutePrepared(size_t, size_t, size_t, const uint16_t *) override {
+    throw DriverException("Not implemented");
+  }
+  void BindBulkColumn(int, const std::string &, int16_t, int, int, void *, size_t,
+                      ssize_t *) override {
+    throw DriverException("Not implemented");
+  }
+  size_t BulkAdd(const std::string *, const std::string *, const std::string &, size_t rows,
+                 size_t, size_t, const uint16_t *) override {
+    return rows;
+  }
+  std::shared_ptr<ResultSet> GetResultSet() override { return nullptr; }
+  long GetUpdateCount() override { return -1; }
+  bool NextResult() override { return false; }
+  std::shared_ptr<ResultSet> GetTables_V2(const std::string *, const std::string *,
+                                          const std::string *, const std::string *) override {
+    throw DriverException("Not implemented");
+  }
+  std::shared_ptr<ResultSet> GetTables_V3(const std::string *, const std::string *,
+                                          const std::string *, const std::string *) override {
+    throw DriverException("Not implemented");
+  }
+  std::shared_ptr<ResultSet> GetColumns_V2(const std::string *, const std::string *,
+                                           const std::string *, const std::string *) override {
+    throw DriverException("Not implemented");
+  }
+  std::shared_ptr<ResultSet> GetColumns_V3(const std::string *, const std::string *,
+                                           const std::string *, const std::string *) override {
+    throw DriverException("Not implemented");
+  }
+  std::shared_ptr<ResultSet> GetTypeInfo_V2(int16_t) override {
+    throw DriverException("Not implemented");
+  }
+  std::shared_ptr<ResultSet> GetTypeInfo_V3(int16_t) override {
+    throw DriverException("Not implemented");
+  }
+  std::shared_ptr<ResultSet> GetPrimaryKeys(const std::string *, const std::string *,
+                                            const std::string *) override {
+    throw DriverException("Not implemented");
+  }
+  std::shared_ptr<ResultSet> GetForeignKeys(const std::string *, const std::string *,
+                                            const std::string *, const std::string *,
+                                            const std::string *, const std::string *) override {
+    throw DriverException("Not implemented");
+  }
+
+private:
+  Diagnostics diagnostics_;
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  bool released_ = false;
+  bool interrupted_ = false;
+  int finished_loads_ = 0;
+};
+
+class AsyncExecutionTest : public ::testing::Test {
+protected:
+  AsyncExecutionTest()
+      : environment_(std::make_shared<FakeDriver>()),
+        connection_(environment_, nullptr),
+        spi_statement_(std::make_shared<BlockingStatement>()),
+        statement_(new ODBCStatement(connection_, spi_statement_)) {
+    statement_->SetStmtAttr(SQL_ATTR_ASYNC_ENABLE,
+                            reinterpret_cast<SQLPOINTER>(SQL_ASYNC_ENABLE_ON), 0, false);
+  }
+
+  /// Calls SQLExecDirect the way an application polling it would.
+  SQLRETURN ExecDirect() {
+    return ODBCStatement::ExecuteAsyncWithDiagnostics(
+        statement_.get(), SQL_API_SQLEXECDIRECT, [this] {
+          spi_statement_->Execute("SELECT 1");
+          return SQL_SUCCESS;
+        });
+  }
+
+  SQLRETURN PollUntilDone() {
+    SQLRETURN ret;
+    while ((ret = ExecDirect()) == SQL_STILL_EXECUTING) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return ret;
+  }
+
+  ODBCEnvironment environment_;
+  ODBCConnection connection_;
+  std::shared_ptr<BlockingStatement> spi_statement_;
+  std::unique_ptr<ODBCStatement> statement_;
+};
+
+class BulkLoadTest : public ::testing::Test {
+protected:
+  BulkLoadTest()
+      : environment_(std::make_shared<FakeDriver>()),
+        connection_(environment_, nullptr),
+        spi_statement_(std::make_shared<BlockingStatement>()),
+        statement_(connection_, spi_statement_) {}
+
+  void SetTable(const char *table) {
+    statement_.SetStmtAttr(SQL_ATTR_GIZMOSQL_BULK_LOAD_TABLE,
+                           const_cast<char *>(table), SQL_NTS, false);
+  }
+
+  ODBCEnvironment environment_;
+  ODBCConnection connection_;
+  std::shared_ptr<BlockingStatement> spi_statement_;
+  ODBCStatement statement_;
+};
+
+} // namespace
+
+TEST_F(BulkLoadTest, LoadIsOnlyCompletedByClearingTheTable) {
+  SetTable("main.items");
+  statement_.BulkAdd();
+  statement_.BulkAdd();
+
+  statement_.closeCursor(true);
+  ASSERT_EQ(0, spi_statement_->finished_loads());
+  try {
+    statement_.ExecuteDirect("SELECT 1");
+    FAIL() << "Executing while a bulk load is open must fail";
+  } catch (const DriverException &e) {
+    ASSERT_EQ("HY010", e.GetSqlState());
+  }
+
+  SetTable(nullptr);
+  ASSERT_EQ(1, spi_statement_->finished_loads());
+}
+
+TEST_F(AsyncExecutionTest, ReportsStillExecutingUntilTheFunctionCompletes) {
+  ASSERT_EQ(SQL_STILL_EXECUTING, ExecDirect());
+  ASSERT_EQ(SQL_STILL_EXECUTING, ExecDirect());
+  ASSERT_TRUE(statement_->IsExecutingAsync());
+
+  spi_statement_->Release();
+  ASSERT_EQ(SQL_SUCCESS, PollUntilDone());
+  ASSERT_FALSE(statement_->IsExecutingAsync());
+}
+
+TEST_F(AsyncExecutionTest, RejectsOtherFunctionsWhileExecuting) {
+  ASSERT_EQ(SQL_STILL_EXECUTING, ExecDirect());
+  ASSERT_EQ(SQL_ERROR, ODBCStatement::ExecuteAsyncWithDiagnostics(
+                           statement_.get(), SQL_API_SQLFETCH, [] { return SQL_SUCCESS; }));
+  ASSERT_EQ("HY010", statement_->GetReportedDiagnostics().GetSQLState(0));
+
+  // The rejected call leaves the diagnostics of the running function alone.
+  spi_statement_->Release();
+  ASSERT_EQ(SQL_SUCCESS, PollUntilDone());
+  ASSERT_FALSE(statement_->GetReportedDiagnostics().HasRecord(0));
+}
+
+TEST_F(AsyncExecutionTest, CancelReportsOperationCanceled) {
+  ASSERT_EQ(SQL_STILL_EXECUTING, ExecDirect());
+  ASSERT_TRUE(statement_->CancelAsync());
+
+  ASSERT_EQ(SQL_ERROR, PollUntilDone());
+  ASSERT_EQ("HY008", statement_->GetDiagnostics().GetSQLState(0));
+  ASSERT_FALSE(spi_statement_->interrupted());
+}
+
+TEST_F(AsyncExecutionTest, FreeingTheStatementInterruptsTheFunction) {
+  ASSERT_EQ(SQL_STILL_EXECUTING, ExecDirect());
+
+  statement_.reset();
+  ASSERT_TRUE(spi_statement_->interrupted());
+}
+
+} // namespace ODBC